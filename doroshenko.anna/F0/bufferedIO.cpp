@@ -0,0 +1,138 @@
+#include "bufferedIO.hpp"
+#include <algorithm>
+#include <cctype>
+#include <istream>
+#include <ostream>
+
+std::string doroshenko::readWholeFile(std::istream& input)
+{
+  std::string buffer;
+  input.seekg(0, std::ios::end);
+  std::streamoff size = input.tellg();
+  input.seekg(0, std::ios::beg);
+  if (size > 0)
+  {
+    buffer.resize(static_cast< size_t >(size));
+    input.read(&buffer[0], size);
+    buffer.resize(static_cast< size_t >(input.gcount()));
+    return buffer;
+  }
+  input.clear();
+  char chunk[1 << 16];
+  while (input.read(chunk, sizeof(chunk)) || input.gcount() > 0)
+  {
+    buffer.append(chunk, static_cast< size_t >(input.gcount()));
+  }
+  input.clear();
+  return buffer;
+}
+
+std::vector< doroshenko::wordCount > doroshenko::countWords(const std::string& text)
+{
+  std::vector< std::string > words;
+  std::string word;
+  bool inWord = false;
+  for (char c : text)
+  {
+    unsigned char symbol = static_cast< unsigned char >(c);
+    if (std::isspace(symbol))
+    {
+      if (inWord)
+      {
+        words.push_back(std::move(word));
+        word.clear();
+        inWord = false;
+      }
+      continue;
+    }
+    inWord = true;
+    if (std::isalnum(symbol))
+    {
+      word += static_cast< char >(std::tolower(symbol));
+    }
+  }
+  if (inWord)
+  {
+    words.push_back(std::move(word));
+  }
+  std::sort(words.begin(), words.end());
+  std::vector< wordCount > counted;
+  for (size_t i = 0; i < words.size(); i++)
+  {
+    if (counted.empty() || counted.back().first != words[i])
+    {
+      counted.emplace_back(std::move(words[i]), 0);
+    }
+    counted.back().second++;
+  }
+  return counted;
+}
+
+doroshenko::BufferedWriter::BufferedWriter(std::ostream& output, size_t blockSize) :
+  output_(output),
+  buffer_(),
+  blockSize_(blockSize)
+{
+  buffer_.reserve(blockSize_ + blockSize_ / 4);
+}
+
+doroshenko::BufferedWriter::~BufferedWriter()
+{
+  flush();
+}
+
+doroshenko::BufferedWriter& doroshenko::BufferedWriter::operator<<(const std::string& str)
+{
+  buffer_ += str;
+  flushIfFull();
+  return *this;
+}
+
+doroshenko::BufferedWriter& doroshenko::BufferedWriter::operator<<(const char* str)
+{
+  buffer_ += str;
+  flushIfFull();
+  return *this;
+}
+
+doroshenko::BufferedWriter& doroshenko::BufferedWriter::operator<<(char c)
+{
+  buffer_ += c;
+  flushIfFull();
+  return *this;
+}
+
+doroshenko::BufferedWriter& doroshenko::BufferedWriter::operator<<(size_t number)
+{
+  char digits[20];
+  size_t length = 0;
+  do
+  {
+    digits[length++] = static_cast< char >('0' + number % 10);
+    number /= 10;
+  }
+  while (number != 0);
+  while (length != 0)
+  {
+    buffer_ += digits[--length];
+  }
+  flushIfFull();
+  return *this;
+}
+
+void doroshenko::BufferedWriter::flush()
+{
+  if (!buffer_.empty())
+  {
+    output_.write(buffer_.data(), static_cast< std::streamsize >(buffer_.size()));
+    buffer_.clear();
+  }
+}
+
+void doroshenko::BufferedWriter::flushIfFull()
+{
+  if (buffer_.size() >= blockSize_)
+  {
+    flush();
+  }
+}
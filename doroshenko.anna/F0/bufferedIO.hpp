@@ -0,0 +1,38 @@
+#ifndef BUFFERED_IO_HPP
+#define BUFFERED_IO_HPP
+#include <iosfwd>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace doroshenko
+{
+  using wordCount = std::pair< std::string, size_t >;
+
+  std::string readWholeFile(std::istream& input);
+  std::vector< wordCount > countWords(const std::string& text);
+
+  class BufferedWriter
+  {
+  public:
+    explicit BufferedWriter(std::ostream& output, size_t blockSize = 1 << 16);
+    BufferedWriter(const BufferedWriter&) = delete;
+    ~BufferedWriter();
+
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    BufferedWriter& operator<<(const std::string& str);
+    BufferedWriter& operator<<(const char* str);
+    BufferedWriter& operator<<(char c);
+    BufferedWriter& operator<<(size_t number);
+    void flush();
+  private:
+    std::ostream& output_;
+    std::string buffer_;
+    size_t blockSize_;
+
+    void flushIfFull();
+  };
+}
+
+#endif
@@ -1,9 +1,78 @@
 #include "commands.hpp"
-#include <iostream>
+#include <algorithm>
+#include <cctype>
 #include <fstream>
-#include "list.hpp"
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <vector>
+#include "bufferedIO.hpp"
+
+namespace
+{
+  using entry_t = const doroshenko::dictionary::keyValPair*;
+  constexpr size_t topSize = 3;
+
+  struct HigherFrequency
+  {
+    bool operator()(entry_t lhs, entry_t rhs) const
+    {
+      return lhs->second > rhs->second || (lhs->second == rhs->second && lhs->first < rhs->first);
+    }
+  };
 
-using dictionary = BST< std::string, std::string >;
+  std::vector< entry_t > selectTop(const doroshenko::dictionary& dict, size_t n)
+  {
+    std::priority_queue< entry_t, std::vector< entry_t >, HigherFrequency > worstOnTop;
+    HigherFrequency isHigher;
+    for (auto it = dict.cbegin(); it != dict.cend(); it++)
+    {
+      if (worstOnTop.size() < n)
+      {
+        worstOnTop.push(&*it);
+      }
+      else if (n != 0 && isHigher(&*it, worstOnTop.top()))
+      {
+        worstOnTop.pop();
+        worstOnTop.push(&*it);
+      }
+    }
+    std::vector< entry_t > result(worstOnTop.size());
+    for (size_t i = result.size(); i > 0; i--)
+    {
+      result[i - 1] = worstOnTop.top();
+      worstOnTop.pop();
+    }
+    return result;
+  }
+
+  std::vector< entry_t > sortByCount(const doroshenko::dictionary& dict)
+  {
+    size_t maxCount = 0;
+    size_t size = 0;
+    for (auto it = dict.cbegin(); it != dict.cend(); it++)
+    {
+      maxCount = std::max(maxCount, it->second);
+      size++;
+    }
+    std::vector< size_t > offsets(maxCount + 2, 0);
+    for (auto it = dict.cbegin(); it != dict.cend(); it++)
+    {
+      offsets[maxCount - it->second + 1]++;
+    }
+    for (size_t i = 1; i < offsets.size(); i++)
+    {
+      offsets[i] += offsets[i - 1];
+    }
+    std::vector< entry_t > result(size);
+    for (auto it = dict.cbegin(); it != dict.cend(); it++)
+    {
+      result[offsets[maxCount - it->second]++] = &*it;
+    }
+    return result;
+  }
+}
 
 void doroshenko::help(std::ostream& output)
 {
@@ -31,7 +100,7 @@ void doroshenko::createDict(BST< std::string, dictionary >& dicts, std::istream&
     return;
   }
   dicts.insert(dictName, dictionary());
-  dictionary currentDict = dicts.at(dictName).second;
+  dictionary& currentDict = dicts.at(dictName).second;
   using namespace std::placeholders;
   BST< std::string, std::function< void(dictionary&, std::istream&, std::ostream&) > > cmdDict;
   cmdDict.insert("delete", std::bind(doroshenko::deleteKey, _1, _2, _3));
@@ -43,8 +112,6 @@ void doroshenko::createDict(BST< std::string, dictionary >& dicts, std::istream&
     if (cmdDict.find(cmdType) != cmdDict.cend())
     {
       cmdDict.at(cmdType).second(currentDict, input, output);
-      dicts.erase(dictName);
-      dicts.insert(dictName, currentDict);
     }
     else
     {
@@ -71,7 +138,7 @@ void doroshenko::findKey(dictionary& dict, std::istream& input, std::ostream& ou
 {
   std::string key;
   input >> key;
-  if (dict.find(key) == dict.cend() || dict.find(key)->second.empty())
+  if (dict.find(key) == dict.cend() || dict.find(key)->second == 0)
   {
     warningElem(output);
     return;
@@ -81,46 +148,25 @@ void doroshenko::findKey(dictionary& dict, std::istream& input, std::ostream& ou
 
 void doroshenko::openFile(dictionary& dict, std::istream& input, std::ostream& output)
 {
-  std::string word;
-  List< std::string > words;
   std::string filename;
   input >> filename;
-  std::ifstream in(filename);
+  std::ifstream in(filename, std::ios::binary);
   if (!in)
   {
     warningFile(output);
     return;
   }
-  while (in >> word)
+  std::vector< wordCount > words = countWords(readWholeFile(in));
+  if (dict.isEmpty())
   {
-    std::string lowercaseWord = "";
-    for (char c : word)
-    {
-      lowercaseWord += std::tolower(c);
-    }
-    std::string result = "";
-    for (char c : lowercaseWord)
-    {
-      if (std::isalnum(c))
-      {
-        result += c;
-      }
-    }
-    words.pushBack(result);
+    dict.assignSorted(words.begin(), words.end());
+    return;
   }
-  for (List< std::string >::Iterator it = words.begin(); it != List< std::string >::ConstIterator(); it++)
+  for (const wordCount& word : words)
   {
-    size_t frequency = 0;
-    for (List< std::string >::Iterator sIt = words.begin(); sIt != List< std::string >::ConstIterator(); sIt++)
+    if (dict.find(word.first) == dict.cend())
     {
-      if (*sIt == *it)
-      {
-        frequency++;
-      }
-    }
-    if (dict.find(*it) == dict.cend())
-    {
-      dict.insert(*it, std::to_string(frequency));
+      dict.insert(word.first, word.second);
     }
   }
 }
@@ -130,7 +176,7 @@ void doroshenko::writeToFile(const BST< std::string, dictionary >& dicts, std::i
   std::string filename;
   in >> filename;
   std::ofstream output;
-  output.open(filename, std::ios::app);
+  output.open(filename, std::ios::app | std::ios::binary);
   if (!output)
   {
     warningFile(out);
@@ -143,13 +189,13 @@ void doroshenko::writeToFile(const BST< std::string, dictionary >& dicts, std::i
     warningDict(out);
     return;
   }
-  dictionary dict = dicts.constFind(dictName)->second;
-  output << "\n" << dictName << "\n";
-  for (auto it = dict.begin(); it != dict.end(); it++)
+  const dictionary& dict = dicts.constFind(dictName)->second;
+  BufferedWriter writer(output);
+  writer << '\n' << dictName << '\n';
+  for (auto it = dict.cbegin(); it != dict.cend(); it++)
   {
-    output << it->first << ": " << it->second << "\n";
+    writer << it->first << ": " << it->second << '\n';
   }
-  output.close();
 }
 
 void doroshenko::removeDict(BST< std::string, dictionary >& dicts, std::istream& in, std::ostream& out)
@@ -213,31 +259,15 @@ void doroshenko::sortByFrequency(BST< std::string, dictionary >& dicts, std::ist
     warningDict(out);
     return;
   }
-  dictionary dictToSort = dicts.find(dictName)->second;
+  dictionary& dictToSort = dicts.find(dictName)->second;
   if (dictToSort.isEmpty() || std::isdigit(dictToSort.begin()->first[0]))
   {
     return;
   }
   out << dictName << "\n";
-  BST< std::string, std::string > temp;
-  for (auto it = dictToSort.begin(); it != dictToSort.end(); it++)
+  for (entry_t entry : sortByCount(dictToSort))
   {
-    temp.insert(it->first, it->second);
-  }
-  size_t i = 0;
-  while (i != temp.getSize())
-  {
-    auto maxIter = temp.begin();
-    for (auto iter = temp.begin(); iter != temp.end(); ++iter)
-    {
-      if (std::stoll(iter->second) > std::stoll(maxIter->second) && std::stoll(iter->second) != 0)
-      {
-        maxIter = iter;
-      }
-    }
-    out << maxIter->first << ": " << maxIter->second << "\n";
-    temp.at(maxIter->first).second = "0";
-    i++;
+    out << entry->first << ": " << entry->second << "\n";
   }
 }
 
@@ -250,13 +280,13 @@ void doroshenko::sortByAlphabet(BST< std::string, dictionary >& dicts, std::istr
     warningDict(out);
     return;
   }
-  dictionary dictToSort = dicts.find(dictName)->second;
+  dictionary& dictToSort = dicts.find(dictName)->second;
   if (dictToSort.isEmpty() || !std::isdigit(dictToSort.begin()->first[0]))
   {
     out << "The dictionary is already sorted\n";
     return;
   }
-  BST< std::string, std::string > temp;
+  BST< size_t, std::string > temp;
   for (auto it = dictToSort.begin(); it != dictToSort.end(); it++)
   {
     temp.insert(it->second, it->first);
@@ -277,26 +307,9 @@ void doroshenko::printTop(BST< std::string, dictionary >& dicts, std::istream& i
     warningDict(out);
     return;
   }
-  dictionary dictToSort = dicts.find(dictName)->second;
-  BST< std::string, std::string > temp;
-  for (auto it = dictToSort.begin(); it != dictToSort.end(); it++)
+  for (entry_t entry : selectTop(dicts.find(dictName)->second, topSize))
   {
-    temp.insert(it->first, it->second);
-  }
-  size_t i = 0;
-  while (i < 3)
-  {
-    auto maxIter = temp.begin();
-    for (auto iter = temp.begin(); iter != temp.end(); ++iter)
-    {
-      if (std::stoll(iter->second) > std::stoll(maxIter->second) && std::stoll(iter->second) != 0)
-      {
-        maxIter = iter;
-      }
-    }
-    out << maxIter->first << ": " << maxIter->second << "\n";
-    temp.at(maxIter->first).second = "0";
-    i++;
+    out << entry->first << ": " << entry->second << "\n";
   }
 }
 
@@ -5,7 +5,7 @@
 
 int main()
 {
-  using dictionary = BST< std::string, std::string >;
+  using doroshenko::dictionary;
   BST< std::string, dictionary > dicts;
   BST< std::string, std::function< void(BST< std::string, dictionary >&, std::istream&, std::ostream&) > > commands;
   {
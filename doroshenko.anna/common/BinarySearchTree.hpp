@@ -34,6 +34,8 @@ namespace doroshenko
     Iterator find(const Key& key);
     Node* insert(const Key& key, const Value& value);
     void insert(const keyValPair& pair);
+    template< typename RandomIt >
+    void assignSorted(RandomIt first, RandomIt last);
     keyValPair& at(const Key& key);
     const keyValPair& at(const Key& key) const;
     Iterator erase(Iterator position);
@@ -69,6 +71,8 @@ namespace doroshenko
     Node* eraseIfOnlyLeftChild(Node*);
     Node* eraseIfOnlyRightChild(Node*);
     Node* eraseIfTwoChildren(Node*);
+    template< typename RandomIt >
+    Node* buildBalanced(RandomIt first, RandomIt last, Node* parent);
   };
 }
 using namespace doroshenko;
@@ -362,7 +366,7 @@ BST< Key, Value, Compare >::~BST()
 template< typename Key, typename Value, typename Compare >
 bool BST< Key, Value, Compare >::isEmpty() noexcept
 {
-  return getSize() == 0 ? true : false;
+  return root_ == nullptr;
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -448,6 +452,41 @@ typename BST< Key, Value, Compare >::Node* BST< Key, Value, Compare >::insert(co
   return newNode;
 }
 
+template< typename Key, typename Value, typename Compare >
+template< typename RandomIt >
+void BST< Key, Value, Compare >::assignSorted(RandomIt first, RandomIt last)
+{
+  clear();
+  root_ = buildBalanced(first, last, nullptr);
+}
+
+template< typename Key, typename Value, typename Compare >
+template< typename RandomIt >
+typename BST< Key, Value, Compare >::Node* BST< Key, Value, Compare >::buildBalanced(RandomIt first, RandomIt last,
+  Node* parent)
+{
+  if (first == last)
+  {
+    return nullptr;
+  }
+  RandomIt middle = first + (last - first) / 2;
+  Node* node = new Node(*middle, parent);
+  try
+  {
+    node->left_ = buildBalanced(first, middle, node);
+    node->right_ = buildBalanced(middle + 1, last, node);
+  }
+  catch (...)
+  {
+    clear(node);
+    throw;
+  }
+  size_t leftH = node->left_ ? node->left_->height_ : 0;
+  size_t rightH = node->right_ ? node->right_->height_ : 0;
+  node->height_ = std::max(leftH, rightH) + 1;
+  return node;
+}
+
 template< typename Key, typename Value, typename Compare >
 typename BST< Key, Value, Compare >::Iterator BST< Key, Value, Compare >::erase(Iterator position)
 {
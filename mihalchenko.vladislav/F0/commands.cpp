@@ -20,8 +20,9 @@ void mihalchenko::help(std::ostream &out)
   out << "7. rename < oldname > < newname > - renaming the dictionary from oldname to newname\n";
   out << "8. delete < name > - deleting a frequency dictionary\n";
   out << "9. find < name > < word / frequency > - output of element(s) by word\n";
-  out << "10. print < name > < sort:no / sort:alph / sort:freq > < reverse:true/false > - output\n";
-  out << "dictionary elements according to the specified sorting conditions\n";
+  out << "10. print < name > < sort:no / sort:alph / sort:freq > < reverse:true/false > < count > - output\n";
+  out << "dictionary elements according to the specified sorting conditions, count limits\n";
+  out << "the output to the first count elements\n";
   out << "11. view - the output of the names of existing dictionaries\n";
   out << "12. clear < name > < start > < stop > - clear the entire dictionary or\n";
   out << "in the selected range\n";
@@ -105,14 +106,7 @@ void mihalchenko::size(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::o
     printWrongInput(out);
     return;
   }
-  size_t count = 0;
-  auto &iter = mapOfDictionaries.find(nameOfDictionary)->second;
-  for (auto iterOfElem = iter.begin(); iterOfElem != iter.end(); iterOfElem++)
-  {
-    count++;
-  }
-  // out << mapOfDictionaries.find(nameOfDictionary)->second.getSize() << "\n";
-  out << count << "\n";
+  out << mapOfDictionaries.find(nameOfDictionary)->second.getSize() << "\n";
 }
 
 void mihalchenko::view(mapOfDicts_t &mapOfDictionaries, std::ostream &out)
@@ -123,20 +117,7 @@ void mihalchenko::view(mapOfDicts_t &mapOfDictionaries, std::ostream &out)
   {
     num++;
     out << num << ". " << iter.first << ", size = ";
-    if (iter.second.begin() == iter.second.end())
-    {
-      out << 0 << "\n";
-    }
-    else
-    {
-      size_t count = 0;
-      for (auto iterOfElem = iter.second.begin(); iterOfElem != iter.second.end(); iterOfElem++)
-      {
-        count++;
-      }
-      // out << iter.second.getSize() << "\n";
-      out << count << "\n";
-    }
+    out << iter.second.getSize() << "\n";
   }
 }
 
@@ -152,12 +133,10 @@ void mihalchenko::find(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::o
   auto &iterOfDict = mapOfDictionaries.find(name)->second;
   if (is >> freq)
   {
-    for (auto iterOfElem = iterOfDict.begin(); iterOfElem != iterOfDict.end(); iterOfElem++)
+    auto range = iterOfDict.equalFreq(freq);
+    for (auto iterOfElem = range.first; iterOfElem != range.second; iterOfElem++)
     {
-      if (iterOfElem->second == freq)
-      {
-        out << iterOfElem->first << "\n";
-      }
+      out << iterOfElem->second << "\n";
     }
   }
   else
@@ -237,13 +216,12 @@ void mihalchenko::edit(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::o
     printWrongInput(out);
     return;
   }
-  if (iterOfDict->second.find(word) == iterOfDict->second.end())
+  if (!iterOfDict->second.setFrequency(word, newFreq))
   {
     throw std::out_of_range("Error: This dictionary doesn't exist\n");
   }
   else
   {
-    iterOfDict->second.find(word)->second = newFreq;
     out << "The data has been successfully changed\n";
   }
 }
@@ -251,7 +229,6 @@ void mihalchenko::edit(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::o
 void mihalchenko::insert(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::ostream &out)
 {
   std::string nameOfDict = "";
-  std::string word;
   if (!(is >> nameOfDict))
   {
     printWrongInput(out);
@@ -260,17 +237,19 @@ void mihalchenko::insert(mapOfDicts_t &mapOfDictionaries, std::istream &is, std:
   auto iterOfDicts = mapOfDictionaries.find(nameOfDict);
   if (iterOfDicts != mapOfDictionaries.end())
   {
-    auto iterOfElem = iterOfDicts->second;
     dictElement_t dictElem;
-    is >> dictElem;
-    if (iterOfElem.find(word) != iterOfElem.end())
+    if (!(is >> dictElem))
+    {
+      printWrongInput(out);
+      return;
+    }
+    if (iterOfDicts->second.insert(dictElem))
     {
-      iterOfDicts->second.insert(dictElem);
       out << "The item was successfully added to the dictionary\n";
     }
     else
     {
-      throw std::out_of_range("Error: This element doesn't exist\n");
+      throw std::out_of_range("Error: This element already exists\n");
     }
   }
   else
@@ -297,9 +276,8 @@ void mihalchenko::remove(mapOfDicts_t &mapOfDictionaries, std::istream &is, std:
       printWrongInput(out);
       return;
     }
-    if (iterOfElem.find(word) != iterOfElem.end())
+    if (iterOfElem.erase(word))
     {
-      iterOfDicts->second.erase(word);
       out << "The item was successfully deleted from the dictionary\n";
     }
     else
@@ -397,15 +375,7 @@ void mihalchenko::count(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::
     return;
   }
   auto &iterOfDicts = mapOfDictionaries.find(nameOfDict)->second;
-  size_t count = 0;
-  for (const auto &it : iterOfDicts)
-  {
-    if (it.second == freq)
-    {
-      count++;
-    }
-  }
-  out << "Words with frequency " << freq << " : " << count << "\n";
+  out << "Words with frequency " << freq << " : " << iterOfDicts.count(freq) << "\n";
 }
 
 void mihalchenko::merge(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::ostream &out)
@@ -422,15 +392,9 @@ void mihalchenko::merge(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::
   auto iterOfDict2 = mapOfDictionaries.find(nameOfDict2);
   if (iterOfDict1 != mapOfDictionaries.end() && iterOfDict2 != mapOfDictionaries.end())
   {
-    dict_t newDict;
-    for (const auto &iterOfElem : iterOfDict1->second)
-    {
-      newDict.insert(iterOfElem.first, iterOfElem.second);
-    }
-    for (const auto &iterOfElem : iterOfDict2->second)
-    {
-      newDict.insert(iterOfElem.first, iterOfElem.second);
-    }
+    const dict_t &dict1 = iterOfDict1->second;
+    const dict_t &dict2 = iterOfDict2->second;
+    dict_t newDict(dict_t::words_t::setUnion(dict1.begin(), dict1.end(), dict2.begin(), dict2.end()));
     mapOfDictionaries.insert(newname, newDict);
     out << "The elements from these dictionaries has been successfully merged into a new file\n";
   }
@@ -450,11 +414,20 @@ void mihalchenko::unique(mapOfDicts_t &mapOfDictionaries, std::istream &is, std:
     printWrongInput(out);
     return;
   }
-  dict_t newDict;
-  findUnique(mapOfDictionaries, newDict, nameOfDict1, nameOfDict2, out);
-  findUnique(mapOfDictionaries, newDict, nameOfDict2, nameOfDict1, out);
-  mapOfDictionaries.insert(newname, newDict);
-  out << "The unique elements from these dictionaries has been successfully merged into a new file\n";
+  auto iterOfDict1 = mapOfDictionaries.find(nameOfDict1);
+  auto iterOfDict2 = mapOfDictionaries.find(nameOfDict2);
+  if (iterOfDict1 != mapOfDictionaries.end() && iterOfDict2 != mapOfDictionaries.end())
+  {
+    const dict_t &dict1 = iterOfDict1->second;
+    const dict_t &dict2 = iterOfDict2->second;
+    dict_t newDict(dict_t::words_t::setSymmetricDifference(dict1.begin(), dict1.end(), dict2.begin(), dict2.end()));
+    mapOfDictionaries.insert(newname, newDict);
+    out << "The unique elements from these dictionaries has been successfully merged into a new file\n";
+  }
+  else
+  {
+    throw std::out_of_range("Error: This dictionary doesn't exist\n");
+  }
 }
 
 void mihalchenko::swap(mapOfDicts_t &mapOfDictionaries, std::istream &is, std::ostream &out)
@@ -4,11 +4,12 @@
 #include <string>
 #include <iostream>
 #include <AVLtree.hpp>
+#include "dictionary.hpp"
 
 namespace mihalchenko
 {
   using dictElement_t = std::pair< std::string, size_t >;
-  using dict_t = AVLTree< std::string, size_t >;
+  using dict_t = Dictionary;
   using mapOfDicts_t = AVLTree< std::string, dict_t >;
 }
 
@@ -0,0 +1,129 @@
+#include "dictionary.hpp"
+#include <limits>
+
+mihalchenko::Dictionary::Dictionary(words_t &&words):
+  words_(std::move(words)),
+  freqIndex_()
+{
+  for (const auto &elem : *this)
+  {
+    freqIndex_.emplace(elem.second, elem.first);
+  }
+}
+
+bool mihalchenko::Dictionary::insert(const std::string &word, size_t freq)
+{
+  if (find(word) != end())
+  {
+    return false;
+  }
+  words_.insert(word, freq);
+  freqIndex_.emplace(freq, word);
+  return true;
+}
+
+bool mihalchenko::Dictionary::insert(const std::pair< std::string, size_t > &elem)
+{
+  return insert(elem.first, elem.second);
+}
+
+bool mihalchenko::Dictionary::erase(const std::string &word)
+{
+  auto iterOfElem = find(word);
+  if (iterOfElem == end())
+  {
+    return false;
+  }
+  freqIndex_.erase(freqElement_t(iterOfElem->second, word));
+  words_.erase(word);
+  return true;
+}
+
+bool mihalchenko::Dictionary::setFrequency(const std::string &word, size_t freq)
+{
+  auto iterOfElem = words_.find(word);
+  if (iterOfElem == words_.end())
+  {
+    return false;
+  }
+  freqIndex_.erase(freqElement_t(iterOfElem->second, word));
+  iterOfElem->second = freq;
+  freqIndex_.emplace(freq, word);
+  return true;
+}
+
+void mihalchenko::Dictionary::clear()
+{
+  words_.clear();
+  freqIndex_.clear();
+}
+
+void mihalchenko::Dictionary::swap(Dictionary &other) noexcept
+{
+  words_.swap(other.words_);
+  freqIndex_.swap(other.freqIndex_);
+}
+
+bool mihalchenko::Dictionary::empty() const noexcept
+{
+  return freqIndex_.empty();
+}
+
+size_t mihalchenko::Dictionary::getSize() const noexcept
+{
+  return freqIndex_.size();
+}
+
+size_t mihalchenko::Dictionary::count(size_t freq) const
+{
+  auto range = equalFreq(freq);
+  size_t result = 0;
+  for (auto iterOfElem = range.first; iterOfElem != range.second; ++iterOfElem)
+  {
+    result++;
+  }
+  return result;
+}
+
+mihalchenko::Dictionary::words_t::ConstIterator mihalchenko::Dictionary::find(const std::string &word) const
+{
+  return words_.find(word);
+}
+
+mihalchenko::Dictionary::words_t::ConstIterator mihalchenko::Dictionary::begin() const
+{
+  return words_.cbegin();
+}
+
+mihalchenko::Dictionary::words_t::ConstIterator mihalchenko::Dictionary::end() const
+{
+  return words_.cend();
+}
+
+mihalchenko::Dictionary::freqIndex_t::const_iterator mihalchenko::Dictionary::freqBegin() const noexcept
+{
+  return freqIndex_.cbegin();
+}
+
+mihalchenko::Dictionary::freqIndex_t::const_iterator mihalchenko::Dictionary::freqEnd() const noexcept
+{
+  return freqIndex_.cend();
+}
+
+mihalchenko::Dictionary::freqIndex_t::const_reverse_iterator mihalchenko::Dictionary::freqRBegin() const noexcept
+{
+  return freqIndex_.crbegin();
+}
+
+mihalchenko::Dictionary::freqIndex_t::const_reverse_iterator mihalchenko::Dictionary::freqREnd() const noexcept
+{
+  return freqIndex_.crend();
+}
+
+std::pair< mihalchenko::Dictionary::freqIndex_t::const_iterator, mihalchenko::Dictionary::freqIndex_t::const_iterator >
+  mihalchenko::Dictionary::equalFreq(size_t freq) const
+{
+  auto first = freqIndex_.lower_bound(freqElement_t(freq, std::string()));
+  auto last = (freq == std::numeric_limits< size_t >::max()) ? freqIndex_.cend() : freqIndex_.lower_bound(freqElement_t(freq + 1, std::string()));
+  return std::make_pair(first, last);
+}
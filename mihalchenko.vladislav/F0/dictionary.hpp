@@ -0,0 +1,46 @@
+#ifndef DICTIONARY_HPP
+#define DICTIONARY_HPP
+
+#include <set>
+#include <string>
+#include <AVLtree.hpp>
+
+namespace mihalchenko
+{
+  class Dictionary
+  {
+  public:
+    using words_t = AVLTree< std::string, size_t >;
+    using freqElement_t = std::pair< size_t, std::string >;
+    using freqIndex_t = std::set< freqElement_t >;
+
+    Dictionary() = default;
+    explicit Dictionary(words_t &&words);
+
+    bool insert(const std::string &word, size_t freq);
+    bool insert(const std::pair< std::string, size_t > &elem);
+    bool erase(const std::string &word);
+    bool setFrequency(const std::string &word, size_t freq);
+    void clear();
+    void swap(Dictionary &other) noexcept;
+
+    bool empty() const noexcept;
+    size_t getSize() const noexcept;
+    size_t count(size_t freq) const;
+    words_t::ConstIterator find(const std::string &word) const;
+
+    words_t::ConstIterator begin() const;
+    words_t::ConstIterator end() const;
+    freqIndex_t::const_iterator freqBegin() const noexcept;
+    freqIndex_t::const_iterator freqEnd() const noexcept;
+    freqIndex_t::const_reverse_iterator freqRBegin() const noexcept;
+    freqIndex_t::const_reverse_iterator freqREnd() const noexcept;
+    std::pair< freqIndex_t::const_iterator, freqIndex_t::const_iterator > equalFreq(size_t freq) const;
+
+  private:
+    words_t words_;
+    freqIndex_t freqIndex_;
+  };
+}
+
+#endif
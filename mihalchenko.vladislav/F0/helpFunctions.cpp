@@ -1,9 +1,8 @@
 #include "helpFunctions.hpp"
 #include <iostream>
+#include <limits>
+#include <sstream>
 #include <string>
-#include <vector>
-#include <iterator>
-#include <algorithm>
 
 std::string mihalchenko::getDictName(std::string &str)
 {
@@ -13,21 +12,17 @@ std::string mihalchenko::getDictName(std::string &str)
 void mihalchenko::sortByFreq(mapOfDicts_t &mapOfDictionaries, const std::string &nameOfDict,
                               std::istream &is, std::ostream &out)
 {
-  std::vector< std::pair< std::string, size_t > > vecToSort;
-  for (const auto &iterOfElem : mapOfDictionaries.find(nameOfDict)->second)
-  {
-    vecToSort.push_back({iterOfElem.first, iterOfElem.second});
-  }
-  std::sort(vecToSort.begin(), vecToSort.end(), compareElemByFreq);
+  const dict_t &dict = mapOfDictionaries.find(nameOfDict)->second;
   bool reverseParam = false;
-  is >> reverseParam;
+  size_t limit = 0;
+  readSortParams(is, reverseParam, limit);
   if (reverseParam == true)
   {
-    std::reverse(vecToSort.begin(), vecToSort.end());
+    printByFreq(dict.freqRBegin(), dict.freqREnd(), limit, out);
   }
-  for (const auto &iterOfElem : vecToSort)
+  else
   {
-    out << iterOfElem.first << " : " << iterOfElem.second << "\n";
+    printByFreq(dict.freqBegin(), dict.freqEnd(), limit, out);
   }
 }
 
@@ -39,21 +34,33 @@ bool mihalchenko::compareElemByFreq(const dictElement_t &iterOfElem1, const dict
 void mihalchenko::sortByAlph(mapOfDicts_t &mapOfDictionaries, const std::string &nameOfDict,
                               std::istream &is, std::ostream &out)
 {
-  std::vector< std::pair< std::string, size_t > > vecToSort;
-  for (const auto &iterOfElem : mapOfDictionaries.find(nameOfDict)->second)
+  const dict_t &dict = mapOfDictionaries.find(nameOfDict)->second;
+  bool reverseParam = false;
+  size_t limit = 0;
+  readSortParams(is, reverseParam, limit);
+  if (dict.empty())
   {
-    vecToSort.push_back({iterOfElem.first, iterOfElem.second});
+    return;
   }
-  std::sort(vecToSort.begin(), vecToSort.end(), compareElemByFreq);
-  bool reverseParam = false;
-  is >> reverseParam;
-  if (reverseParam == true)
+  auto iterOfElem = (reverseParam == true) ? --dict.end() : dict.begin();
+  for (size_t i = 0; (i < limit) && (iterOfElem != dict.end()); ++i)
   {
-    std::reverse(vecToSort.begin(), vecToSort.end());
+    out << iterOfElem->first << " : " << iterOfElem->second << "\n";
+    (reverseParam == true) ? --iterOfElem : ++iterOfElem;
   }
-  for (const auto &iterOfElem : vecToSort)
+}
+
+void mihalchenko::readSortParams(std::istream &is, bool &reverseParam, size_t &limit)
+{
+  std::string params = "";
+  std::getline(is, params);
+  std::istringstream paramsStream(params);
+  std::string reverseStr = "";
+  paramsStream >> reverseStr;
+  reverseParam = (reverseStr == "true") || (reverseStr == "1");
+  if (!(paramsStream >> limit))
   {
-    out << iterOfElem.first << " : " << iterOfElem.second << "\n";
+    limit = std::numeric_limits< size_t >::max();
   }
 }
 
@@ -79,33 +86,3 @@ std::ostream &mihalchenko::printWrongInput(std::ostream &out)
   out << "Wrong input!\n";
   return out;
 }
-
-void mihalchenko::findUnique(mapOfDicts_t &mapOfDictionaries, dict_t &newDict,
-                              const std::string &nameOfDict1, const std::string &nameOfDict2, std::ostream &out)
-{
-  auto iterOfDict1 = mapOfDictionaries.find(nameOfDict1);
-  auto iterOfDict2 = mapOfDictionaries.find(nameOfDict2);
-  if (iterOfDict1 != mapOfDictionaries.end() && iterOfDict2 != mapOfDictionaries.end())
-  {
-    for (auto iterOfElem1 : iterOfDict1->second)
-    {
-      bool flag = false;
-      for (auto iterOfElem2 : iterOfDict2->second)
-      {
-        if (iterOfDict1 == iterOfDict2)
-        {
-          flag = false;
-          break;
-        }
-      }
-      if (flag == false)
-      {
-        newDict.insert(iterOfElem1.first, iterOfElem1.second);
-      }
-    }
-  }
-  else
-  {
-    printErrorMessage(out);
-  }
-}
@@ -8,13 +8,23 @@ namespace mihalchenko
   std::string getDictName(std::string &str);
   void sortByFreq(mapOfDicts_t &mapOfDictionaries, const std::string &nameOfDict, std::istream &is, std::ostream &out);
   void sortByAlph(mapOfDicts_t &mapOfDictionaries, const std::string &nameOfDict, std::istream &is, std::ostream &out);
+  void readSortParams(std::istream &is, bool &reverseParam, size_t &limit);
+  template< typename Iter >
+  void printByFreq(Iter start, Iter stop, size_t limit, std::ostream &out);
   bool compareElemByFreq(const dictElement_t &iterOfElem1, const dictElement_t &iterOfElem2);
   bool compareElemByAlph(const dictElement_t &iterOfElem1, const dictElement_t &iterOfElem2);
   std::ostream &printInvalidCommand(std::ostream &out);
   std::ostream &printErrorMessage(std::ostream &out);
   std::ostream &printWrongInput(std::ostream &out);
-  void findUnique(mapOfDicts_t &mapOfDictionaries, dict_t &newDict,
-                    const std::string &nameOfDict1, const std::string &nameOfDict2, std::ostream &out);
+}
+
+template< typename Iter >
+void mihalchenko::printByFreq(Iter start, Iter stop, size_t limit, std::ostream &out)
+{
+  for (size_t i = 0; (i < limit) && (start != stop); ++i, ++start)
+  {
+    out << start->second << " : " << start->first << "\n";
+  }
 }
 
 #endif
@@ -5,6 +5,7 @@
 #include <initializer_list>
 #include <functional>
 #include <iostream>
+#include <vector>
 #include "stack.hpp"
 #include "queue.hpp"
 
@@ -52,6 +53,15 @@ namespace mihalchenko
     Iterator begin() noexcept;
     Iterator end() noexcept;
 
+    template < class InputIt1, class InputIt2 >
+    static AVLTree setUnion(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2);
+    template < class InputIt1, class InputIt2 >
+    static AVLTree setIntersection(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2);
+    template < class InputIt1, class InputIt2 >
+    static AVLTree setDifference(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2);
+    template < class InputIt1, class InputIt2 >
+    static AVLTree setSymmetricDifference(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2);
+
     template< typename F >
     F constTraverseLR(F stackFunc) const;
     template< typename F >
@@ -84,6 +94,7 @@ namespace mihalchenko
     Iterator findNode(const Key &key, Node *node);
     ConstIterator findNode(const Key &key, Node *node) const;
     Node *eraseNode(const Key &key);
+    void replaceChild(Node *oldChild, Node *newChild);
 
     int calcHeight(Node *node);
     void balancingTree(Node *overweight);
@@ -97,6 +108,10 @@ namespace mihalchenko
     const Node *getRoot() const;
 
     Node *copyTree(Node *node, Node *previous);
+    template < class InputIt1, class InputIt2 >
+    static AVLTree mergeSorted(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2,
+        bool takeFirst, bool takeBoth, bool takeSecond);
+    static Node *buildBalanced(Node **start, Node **stop, Node *previous);
     void clear(Node *node);
 
     Node *root_;
@@ -216,89 +231,56 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::Node
   *mihalchenko::AVLTree< Key, Value, Compare >::eraseNode(const Key &key)
 {
   Node *deletedNode = find(key).constIter_.node_;
-  Node *prevDelNode = deletedNode->previous_;
-  Node *workerNode = deletedNode;
-  Node *firstRightNode = nullptr;
-  Node *tempNode = nullptr;
-  if ((deletedNode->left_ == nullptr) && (deletedNode->right_ == nullptr))
+  if ((deletedNode->left_ != nullptr) && (deletedNode->right_ != nullptr))
   {
-    if (prevDelNode)
+    Node *nextNode = deletedNode->right_;
+    while (nextNode->left_)
     {
-      if (prevDelNode->left_)
-      {
-        (prevDelNode->left_ == deletedNode) ? prevDelNode->left_ = nullptr : prevDelNode->right_ = nullptr;
-      }
-      else
-      {
-        (prevDelNode->right_ == deletedNode) ? prevDelNode->right_ = nullptr : prevDelNode->left_ = nullptr;
-      }
+      nextNode = nextNode->left_;
     }
-    else
+    if (nextNode->previous_ != deletedNode)
     {
-      root_ = nullptr;
+      nextNode->previous_->left_ = nextNode->right_;
+      if (nextNode->right_)
+      {
+        nextNode->right_->previous_ = nextNode->previous_;
+      }
+      nextNode->right_ = deletedNode->right_;
+      nextNode->right_->previous_ = nextNode;
     }
-    tempNode = deletedNode;
-    delete deletedNode;
+    nextNode->left_ = deletedNode->left_;
+    nextNode->left_->previous_ = nextNode;
+    replaceChild(deletedNode, nextNode);
   }
-  else if (!(deletedNode->left_ == nullptr) && !(deletedNode->right_ == nullptr))
+  else
   {
-    workerNode = deletedNode->right_;
-    while (workerNode->left_)
-    {
-      workerNode = workerNode->left_;
-    }
-    firstRightNode = workerNode;
+    replaceChild(deletedNode, (deletedNode->left_) ? deletedNode->left_ : deletedNode->right_);
+  }
+  delete deletedNode;
+  size_--;
+  return deletedNode;
+}
 
-    workerNode = deletedNode->left_;
-    workerNode->previous_ = firstRightNode;
-    firstRightNode->left_ = workerNode;
-    if (deletedNode == root_)
-    {
-      root_ = firstRightNode;
-    }
-    tempNode = deletedNode;
-    delete deletedNode;
+template < typename Key, typename Value, typename Compare >
+void mihalchenko::AVLTree< Key, Value, Compare >::replaceChild(Node *oldChild, Node *newChild)
+{
+  Node *parent = oldChild->previous_;
+  if (newChild)
+  {
+    newChild->previous_ = parent;
+  }
+  if (parent == nullptr)
+  {
+    root_ = newChild;
+  }
+  else if (parent->left_ == oldChild)
+  {
+    parent->left_ = newChild;
   }
   else
   {
-    if (prevDelNode)
-    {
-      if (prevDelNode->left_ == deletedNode)
-      {
-        if (!(deletedNode->left_ = nullptr))
-        {
-          deletedNode->left_->previous_ = prevDelNode;
-          prevDelNode->left_ = deletedNode->left_;
-        }
-        else
-        {
-          deletedNode->right_->previous_ = prevDelNode;
-          prevDelNode->left_ = deletedNode->right_;
-        }
-      }
-      else
-      {
-        if (!(deletedNode->right_ = nullptr))
-        {
-          deletedNode->left_->previous_ = prevDelNode;
-          prevDelNode->right_ = deletedNode->left_;
-        }
-        else
-        {
-          deletedNode->right_->previous_ = prevDelNode;
-          prevDelNode->right_ = deletedNode->right_;
-        }
-      }
-    }
-    else
-    {
-      (deletedNode->right_) ? root_ = deletedNode->right_ : root_ = deletedNode->left_;
-    }
-    tempNode = deletedNode;
-    delete deletedNode;
+    parent->right_ = newChild;
   }
-  size_--;
-  return tempNode;
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -349,13 +331,14 @@ template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::AVLTree(const AVLTree &copy)
 {
   root_ = copyTree(copy.root_, nullptr);
+  size_ = copy.size_;
 }
 
 template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::AVLTree(AVLTree &&move)
 {
-  root_ = copyTree(std::move(move.root_), nullptr);
-  move.clear();
+  root_ = move.root_;
+  size_ = move.size_;
   move.root_ = nullptr;
   move.size_ = 0;
 }
@@ -467,12 +450,14 @@ template < typename Key, typename Value, typename Compare >
 void mihalchenko::AVLTree< Key, Value, Compare >::clear()
 {
   clear(root_);
+  size_ = 0;
 }
 
 template < typename Key, typename Value, typename Compare >
 void mihalchenko::AVLTree< Key, Value, Compare >::swap(AVLTree &other) noexcept
 {
   std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -519,9 +504,9 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator
     return cend();
   }
   Node *temp = root_;
-  while (temp->left != nullptr)
+  while (temp->left_ != nullptr)
   {
-    temp = temp->left;
+    temp = temp->left_;
   }
   return ConstIterator(temp, root_);
 }
@@ -690,6 +675,111 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::Node
   return newnode;
 }
 
+template < typename Key, typename Value, typename Compare >
+template < class InputIt1, class InputIt2 >
+mihalchenko::AVLTree< Key, Value, Compare >
+  mihalchenko::AVLTree< Key, Value, Compare >::setUnion(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2)
+{
+  return mergeSorted(start1, stop1, start2, stop2, true, true, true);
+}
+
+template < typename Key, typename Value, typename Compare >
+template < class InputIt1, class InputIt2 >
+mihalchenko::AVLTree< Key, Value, Compare >
+  mihalchenko::AVLTree< Key, Value, Compare >::setIntersection(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2)
+{
+  return mergeSorted(start1, stop1, start2, stop2, false, true, false);
+}
+
+template < typename Key, typename Value, typename Compare >
+template < class InputIt1, class InputIt2 >
+mihalchenko::AVLTree< Key, Value, Compare >
+  mihalchenko::AVLTree< Key, Value, Compare >::setDifference(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2)
+{
+  return mergeSorted(start1, stop1, start2, stop2, true, false, false);
+}
+
+template < typename Key, typename Value, typename Compare >
+template < class InputIt1, class InputIt2 >
+mihalchenko::AVLTree< Key, Value, Compare >
+  mihalchenko::AVLTree< Key, Value, Compare >::setSymmetricDifference(InputIt1 start1, InputIt1 stop1,
+      InputIt2 start2, InputIt2 stop2)
+{
+  return mergeSorted(start1, stop1, start2, stop2, true, false, true);
+}
+
+template < typename Key, typename Value, typename Compare >
+template < class InputIt1, class InputIt2 >
+mihalchenko::AVLTree< Key, Value, Compare >
+  mihalchenko::AVLTree< Key, Value, Compare >::mergeSorted(InputIt1 start1, InputIt1 stop1, InputIt2 start2, InputIt2 stop2,
+      bool takeFirst, bool takeBoth, bool takeSecond)
+{
+  Compare compare;
+  std::vector< Node * > nodes;
+  try
+  {
+    while ((start1 != stop1) || (start2 != stop2))
+    {
+      if ((start2 == stop2) || ((start1 != stop1) && compare(start1->first, start2->first)))
+      {
+        if (takeFirst)
+        {
+          nodes.push_back(new Node(start1->first, start1->second));
+        }
+        ++start1;
+      }
+      else if ((start1 == stop1) || compare(start2->first, start1->first))
+      {
+        if (takeSecond)
+        {
+          nodes.push_back(new Node(start2->first, start2->second));
+        }
+        ++start2;
+      }
+      else
+      {
+        if (takeBoth)
+        {
+          nodes.push_back(new Node(start1->first, start1->second));
+        }
+        ++start1;
+        ++start2;
+      }
+    }
+  }
+  catch (...)
+  {
+    for (Node *node : nodes)
+    {
+      delete node;
+    }
+    throw;
+  }
+  AVLTree result;
+  result.root_ = buildBalanced(nodes.data(), nodes.data() + nodes.size(), nullptr);
+  result.size_ = nodes.size();
+  return result;
+}
+
+template < typename Key, typename Value, typename Compare >
+typename mihalchenko::AVLTree< Key, Value, Compare >::Node
+  *mihalchenko::AVLTree< Key, Value, Compare >::buildBalanced(Node **start, Node **stop, Node *previous)
+{
+  if (start == stop)
+  {
+    return nullptr;
+  }
+  Node **middle = start + (stop - start) / 2;
+  Node *node = *middle;
+  node->previous_ = previous;
+  node->left_ = buildBalanced(start, middle, node);
+  node->right_ = buildBalanced(middle + 1, stop, node);
+  int heightLeft = (node->left_) ? node->left_->height_ : 0;
+  int heightRight = (node->right_) ? node->right_->height_ : 0;
+  node->height_ = ((heightLeft > heightRight) ? heightLeft : heightRight) + 1;
+  return node;
+}
+
 template < typename Key, typename Value, typename Compare >
 mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator::ConstIterator()
 {
@@ -907,7 +997,7 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator
   Compare compare;
   if (node == nullptr)
   {
-    return end();
+    return cend();
   }
   if (node->pairOfKeyVal_.first == key)
   {
@@ -921,7 +1011,7 @@ typename mihalchenko::AVLTree< Key, Value, Compare >::ConstIterator
   {
     return findNode(key, node->right_);
   }
-  return end();
+  return cend();
 }
 
 template < typename Key, typename Value, typename Compare >
@@ -0,0 +1,123 @@
+#include "dictionary.hpp"
+#include <algorithm>
+
+bool nikiforov::FrequencyCompare::operator()(const std::pair< size_t, std::string >& lhs,
+  const std::pair< size_t, std::string >& rhs) const
+{
+  if (lhs.first != rhs.first)
+  {
+    return lhs.first > rhs.first;
+  }
+  return lhs.second < rhs.second;
+}
+
+nikiforov::Dictionary::Dictionary(words_t&& words) :
+  words(std::move(words)), frequencyIndex(), stored()
+{
+  for (auto it = this->words.cbegin(); it != this->words.cend(); ++it)
+  {
+    frequencyIndex.emplace(it->second, it->first);
+  }
+}
+
+nikiforov::Dictionary::Dictionary(std::shared_ptr< const StoredDictionary > stored) :
+  words(), frequencyIndex(), stored(std::move(stored))
+{}
+
+nikiforov::Dictionary::Dictionary(const Dictionary& lhs, const Dictionary& rhs, MergePolicy policy) :
+  Dictionary(words_t(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), [policy](size_t lhsFreq, size_t rhsFreq)
+  {
+    if (policy == MergePolicy::keep)
+    {
+      return lhsFreq;
+    }
+    else if (policy == MergePolicy::max)
+    {
+      return std::max(lhsFreq, rhsFreq);
+    }
+    return lhsFreq + rhsFreq;
+  }))
+{}
+
+nikiforov::Dictionary::words_t::ConstIterator nikiforov::Dictionary::cbegin() const
+{
+  load();
+  return words.cbegin();
+}
+
+nikiforov::Dictionary::words_t::ConstIterator nikiforov::Dictionary::cend() const
+{
+  load();
+  return words.cend();
+}
+
+nikiforov::Dictionary::frequencyIndex_t::const_iterator nikiforov::Dictionary::mostBegin() const
+{
+  load();
+  return frequencyIndex.cbegin();
+}
+
+nikiforov::Dictionary::frequencyIndex_t::const_iterator nikiforov::Dictionary::mostEnd() const
+{
+  load();
+  return frequencyIndex.cend();
+}
+
+size_t nikiforov::Dictionary::getSize() const noexcept
+{
+  return stored ? stored->getSize() : words.getSize();
+}
+
+size_t nikiforov::Dictionary::getFrequency(const std::string& word) const
+{
+  if (stored)
+  {
+    return stored->getFrequency(word);
+  }
+  auto it = words.find(word);
+  return it == words.end() ? 0 : it->second;
+}
+
+void nikiforov::Dictionary::add(const std::string& word, size_t frequency)
+{
+  load();
+  auto it = words.find(word);
+  if (it == words.end())
+  {
+    words.emplace(word, frequency);
+    frequencyIndex.emplace(frequency, word);
+  }
+  else
+  {
+    frequencyIndex.erase(std::make_pair(it->second, word));
+    it->second += frequency;
+    frequencyIndex.emplace(it->second, word);
+  }
+}
+
+bool nikiforov::Dictionary::erase(const std::string& word)
+{
+  load();
+  auto it = words.find(word);
+  if (it == words.end())
+  {
+    return false;
+  }
+  frequencyIndex.erase(std::make_pair(it->second, word));
+  words.erase(word);
+  return true;
+}
+
+void nikiforov::Dictionary::load() const
+{
+  if (!stored)
+  {
+    return;
+  }
+  stored->load(words);
+  for (auto it = words.cbegin(); it != words.cend(); ++it)
+  {
+    frequencyIndex.emplace(it->second, it->first);
+  }
+  stored.reset();
+}
@@ -0,0 +1,54 @@
+#ifndef DICTIONARY_HPP
+#define DICTIONARY_HPP
+#include <memory>
+#include <set>
+#include <string>
+#include <AvlTree.hpp>
+#include "dictionaryStore.hpp"
+
+namespace nikiforov
+{
+  struct FrequencyCompare
+  {
+    bool operator()(const std::pair< size_t, std::string >& lhs, const std::pair< size_t, std::string >& rhs) const;
+  };
+
+  class Dictionary
+  {
+  public:
+    using words_t = AvlTree< std::string, size_t >;
+    using frequencyIndex_t = std::set< std::pair< size_t, std::string >, FrequencyCompare >;
+
+    enum class MergePolicy
+    {
+      keep,
+      sum,
+      max
+    };
+
+    Dictionary() = default;
+    explicit Dictionary(words_t&& words);
+    explicit Dictionary(std::shared_ptr< const StoredDictionary > stored);
+    Dictionary(const Dictionary& lhs, const Dictionary& rhs, MergePolicy policy);
+
+    words_t::ConstIterator cbegin() const;
+    words_t::ConstIterator cend() const;
+    frequencyIndex_t::const_iterator mostBegin() const;
+    frequencyIndex_t::const_iterator mostEnd() const;
+
+    size_t getSize() const noexcept;
+    size_t getFrequency(const std::string& word) const;
+
+    void add(const std::string& word, size_t frequency);
+    bool erase(const std::string& word);
+
+  private:
+    mutable words_t words;
+    mutable frequencyIndex_t frequencyIndex;
+    mutable std::shared_ptr< const StoredDictionary > stored;
+
+    void load() const;
+  };
+}
+
+#endif
@@ -1,18 +1,28 @@
 #include "dictionaryCommands.hpp"
+#include <cctype>
+#include <exception>
 #include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <dirent.h>
+#include "mappedFile.hpp"
 
 void nikiforov::printCommands(std::ostream& out)
 {
   out << " 1. help - displaying a list of available commands with parameters\n";
   out << " 2. create < filename > - creating a frequency dictionary from a filename file from a folder with a given name\n";
-  out << " 3. open < mkdir > - reading all added frequency dictionaries from the mkdir folder\n";
+  out << " 3. open < mkdir > - reading all saved dictionaries (.dict) and texts (.txt) from the mkdir folder\n";
   out << " 4. delete < name > - deleting a frequency dictionary with the name name\n";
   out << " 5. list - output the names of all existing frequency dictionaries\n";
   out << " 6. add < name1 > < name2 > - adding the name2 frequency dictionary to the name1 dictionary\n";
-  out << " 7. unite < newname > < name1 > < name2 > - creating a newname dictionary by combining two dictionaries name1 and name2\n";
+  out << " 7. unite < newname > < name1 > < name2 > [ keep | sum | max ] - creating a newname dictionary by combining two dictionaries name1 and name2,\n";
+  out << "    the option chooses the frequency of common words: from name1, the sum (by default) or the maximum\n";
   out << " 8. rename < name > < newname > - renaming the dictionary name to newname\n";
   out << " 9. clear < name1 > < name2 > - deleting all words from the name1 dictionary that are in the name2 dictionary\n";
-  out << " 10. save < mkdir > - saving dictionaries to the mkdir folder where dictionaries will be saved as files\n";
+  out << " 10. save < mkdir > - saving dictionaries to the mkdir folder where dictionaries will be saved as binary .dict files\n";
   out << " 11. select < name > - selecting the name dictionary for which the following commands will be executed\n";
   out << " 12. print - output of the entire sorted list of words with their frequency\n";
   out << " 13. print < most > < n > - the < most > option uses the n parameter to output the most frequently occurring n words\n";
@@ -23,14 +33,14 @@ void nikiforov::printCommands(std::ostream& out)
 
 std::string nikiforov::cutNameFile(std::string& str)
 {
-  size_t startPos = 0;
-  size_t finalPos = str.find(".txt");
-  if (str.find_last_of('\\') != std::string::npos)
+  size_t startPos = str.find_last_of('/');
+  startPos = (startPos == std::string::npos) ? 0 : startPos + 1;
+  size_t finalPos = str.find_last_of('.');
+  if (finalPos == std::string::npos || finalPos < startPos)
   {
-    startPos = str.find_last_of('\\') + 1;
-    finalPos -= 4;
+    finalPos = str.size();
   }
-  return std::string(str.substr(startPos, finalPos));
+  return str.substr(startPos, finalPos - startPos);
 }
 
 void nikiforov::createDict(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out, std::string mkdir)
@@ -41,75 +51,148 @@ void nikiforov::createDict(mapDictionaries_t& mapDictionaries, std::istream& in,
   {
     if (!mkdir.empty())
     {
-      fileName = mkdir + "\\" + fileName;
+      fileName = mkdir + "/" + fileName;
     }
-    std::ifstream input;
-    input.open(fileName);
+    nikiforov::MappedFile input(fileName);
 
     if (input.is_open())
     {
       std::string name = cutNameFile(fileName);
       nikiforov::AvlTree< std::string, size_t > dictionary;
-      nikiforov::getDictionary(dictionary, input);
-      mapDictionaries.emplace(name, dictionary);
+      nikiforov::getDictionary(dictionary, input.begin(), input.end());
+      mapDictionaries.emplace(name, nikiforov::Dictionary(std::move(dictionary)));
       out << " The " << name << " dictionary has been added successfully\n";
     }
     else
     {
       out << " Invalid file name\n";
     }
-
-    input.close();
   }
 }
 
 void nikiforov::getDictionary(nikiforov::AvlTree<std::string, size_t>& dictionary, std::istream& in)
 {
-  std::string word;
+  std::string text((std::istreambuf_iterator< char >(in)), std::istreambuf_iterator< char >());
+  getDictionary(dictionary, text.data(), text.data() + text.size());
+}
+
+void nikiforov::getDictionary(nikiforov::AvlTree< std::string, size_t >& dictionary, const char* first, const char* last)
+{
+  const size_t minShardSize = 1 << 20;
+  size_t textSize = last - first;
+  size_t countShards = std::min< size_t >(std::max(std::thread::hardware_concurrency(), 1u), textSize / minShardSize + 1);
+
+  std::vector< const char* > bounds(countShards + 1, last);
+  bounds[0] = first;
+  for (size_t i = 1; i < countShards; i++)
+  {
+    const char* bound = std::max(first + textSize * i / countShards, bounds[i - 1]);
+    bounds[i] = std::find_if(bound, last, [](char c) { return std::isspace(static_cast< unsigned char >(c)); });
+  }
+
+  std::vector< std::unordered_map< std::string, size_t > > shards(countShards);
+  std::vector< std::exception_ptr > errors(countShards);
+  auto countShard = [&bounds, &shards, &errors](size_t i)
+  {
+    try
+    {
+      countWords(bounds[i], bounds[i + 1], shards[i]);
+    }
+    catch (...)
+    {
+      errors[i] = std::current_exception();
+    }
+  };
 
-  while (!in.eof())
+  std::vector< std::thread > workers;
+  try
   {
-    if (in >> word)
+    for (size_t i = 1; i < countShards; i++)
     {
+      workers.emplace_back(countShard, i);
+    }
+  }
+  catch (...)
+  {
+    for (auto&& worker : workers)
+    {
+      worker.join();
+    }
+    throw;
+  }
+  countShard(0);
+  for (auto&& worker : workers)
+  {
+    worker.join();
+  }
+  for (auto&& error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+
+  for (size_t i = 1; i < countShards; i++)
+  {
+    for (auto&& word : shards[i])
+    {
+      shards[0][word.first] += word.second;
+    }
+    shards[i].clear();
+  }
+  for (auto it = dictionary.begin(); it != dictionary.end(); ++it)
+  {
+    shards[0][it->first] += it->second;
+  }
+
+  std::vector< std::pair< std::string, size_t > > words(shards[0].begin(), shards[0].end());
+  shards[0].clear();
+  std::sort(words.begin(), words.end());
+  dictionary.clear();
+  dictionary.insertSorted(words.begin(), words.end());
+}
+
+void nikiforov::countWords(const char* first, const char* last, std::unordered_map< std::string, size_t >& words)
+{
+  auto isSpace = [](char c)
+  {
+    return std::isspace(static_cast< unsigned char >(c));
+  };
+
+  std::string word;
+  while (first != last)
+  {
+    first = std::find_if_not(first, last, isSpace);
+    const char* wordEnd = std::find_if(first, last, isSpace);
+    if (first != wordEnd)
+    {
+      word.assign(first, wordEnd);
       deleteDelimeters(word);
-      if (checkAlpha(word))
+      if (!word.empty() && checkAlpha(word))
       {
-        auto search = dictionary.find(word);
-        if (search == dictionary.end())
-        {
-          dictionary.emplace(word, 1);
-        }
-        else
-        {
-          dictionary.at(word) = search->second + 1;
-        }
+        ++words[word];
       }
     }
+    first = wordEnd;
   }
 }
 
 void nikiforov::deleteDelimeters(std::string& str)
 {
-  nikiforov::AvlTree< char, char > delimiters;
-  {
-    delimiters.emplace('"', '"');
-    delimiters.emplace('\'', '\'');
-    delimiters.emplace('(', ')');
-    delimiters.emplace('[', ']');
-    delimiters.emplace('<', '>');
-    delimiters.emplace('{', '}');
-  }
+  const std::string openings = "\"'([<{";
+  const std::string closings = "\"')]>}";
 
-  if ((str.back() == ',' || str.back() == '.' ||
+  if (!str.empty() && (str.back() == ',' || str.back() == '.' ||
     str.back() == ':' || str.back() == ';' ||
     str.back() == '!' || str.back() == '?'))
   {
     str.erase(str.end() - 1);
   }
-  auto pairDelimetrs = delimiters.find(str.front());
-  if (pairDelimetrs != delimiters.end())
+  size_t pairDelimetrs = str.empty() ? std::string::npos : openings.find(str.front());
+  if (pairDelimetrs != std::string::npos)
   {
-    if (str.back() == pairDelimetrs->second)
+    if (str.size() > 1 && str.back() == closings[pairDelimetrs])
     {
       str.erase(str.end() - 1);
     }
@@ -121,7 +204,7 @@ bool nikiforov::checkAlpha(std::string& str)
 {
   for (size_t i = 0; i < str.size(); i++)
   {
-    if (!isalpha(str.at(i)))
+    if (!std::isalpha(static_cast< unsigned char >(str.at(i))))
     {
       return false;
     }
@@ -133,16 +216,33 @@ void nikiforov::open(mapDictionaries_t& mapDictionaries, std::istream& in, std::
 {
   std::string mkdir;
   in >> mkdir;
-  std::string intermediateFile = "intermediateFileWithFiles.txt";
-  std::string command = "dir " + mkdir + "\\*.txt /b > " + intermediateFile;
-  if (!std::system(command.c_str()))
+  DIR* dir = opendir(mkdir.c_str());
+  if (dir)
   {
-    std::ifstream fin;
-    fin.open(intermediateFile);
-    while (!fin.eof())
+    while (dirent* entry = readdir(dir))
     {
-      createDict(mapDictionaries, fin, out, mkdir);
+      std::string fileName = entry->d_name;
+      if (hasExtension(fileName, ".dict"))
+      {
+        std::string name = cutNameFile(fileName);
+        auto stored = std::make_shared< const StoredDictionary >(mkdir + "/" + fileName);
+        if (stored->is_valid())
+        {
+          mapDictionaries.emplace(name, nikiforov::Dictionary(std::move(stored)));
+          out << " The " << name << " dictionary has been added successfully\n";
+        }
+        else
+        {
+          out << " Invalid file name\n";
+        }
+      }
+      else if (hasExtension(fileName, ".txt"))
+      {
+        std::istringstream names(fileName);
+        createDict(mapDictionaries, names, out, mkdir);
+      }
     }
+    closedir(dir);
     out << " The files in the folder have been successfully read\n";
   }
   else
@@ -151,6 +251,12 @@ void nikiforov::open(mapDictionaries_t& mapDictionaries, std::istream& in, std::
   }
 }
 
+bool nikiforov::hasExtension(const std::string& fileName, const std::string& extension)
+{
+  return fileName.size() > extension.size()
+    && fileName.compare(fileName.size() - extension.size(), extension.size(), extension) == 0;
+}
+
 void nikiforov::deleteDict(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out)
 {
   std::string nameDictionaryToDel;
@@ -186,9 +292,9 @@ void nikiforov::add(mapDictionaries_t& mapDictionaries, std::istream& in, std::o
 
   if (firstDictionary != mapDictionaries.end() && secondDictionary != mapDictionaries.end())
   {
-    for (auto it = secondDictionary->second.begin(); it != secondDictionary->second.end(); ++it)
+    for (auto it = secondDictionary->second.cbegin(); it != secondDictionary->second.cend(); ++it)
     {
-      firstDictionary->second.emplace(it->first, it->second);
+      firstDictionary->second.add(it->first, it->second);
     }
     out << " Dictionary '" << name2 << "' successfully added to the dictionary '" << name1 << "'\n";
   }
@@ -206,6 +312,25 @@ void nikiforov::unit(mapDictionaries_t& mapDictionaries, std::istream& in, std::
 
   in >> newname >> name1 >> name2;
 
+  std::string policyName;
+  std::getline(in, policyName);
+  policyName.erase(0, policyName.find_first_not_of(' '));
+  policyName.erase(policyName.find_last_not_of(' ') + 1);
+  Dictionary::MergePolicy policy = Dictionary::MergePolicy::sum;
+  if (policyName == "keep")
+  {
+    policy = Dictionary::MergePolicy::keep;
+  }
+  else if (policyName == "max")
+  {
+    policy = Dictionary::MergePolicy::max;
+  }
+  else if (!policyName.empty() && policyName != "sum")
+  {
+    out << " Error: Invalid option\n";
+    return;
+  }
+
   if (newname != name1 && newname != name2)
   {
     auto firstDictionary = mapDictionaries.find(name1);
@@ -213,12 +338,7 @@ void nikiforov::unit(mapDictionaries_t& mapDictionaries, std::istream& in, std::
 
     if (firstDictionary != mapDictionaries.end() && secondDictionary != mapDictionaries.end())
     {
-      nikiforov::AvlTree< std::string, size_t > newDictionary = firstDictionary->second;
-      for (auto it = secondDictionary->second.begin(); it != secondDictionary->second.end(); ++it)
-      {
-        newDictionary.emplace(it->first, it->second);
-      }
-      mapDictionaries.emplace(newname, newDictionary);
+      mapDictionaries.emplace(newname, nikiforov::Dictionary(firstDictionary->second, secondDictionary->second, policy));
       out << " Dictionary '" << name2 << "' successfully added to the dictionary '" << name1 << "'\n";
     }
     else
@@ -272,12 +392,9 @@ void nikiforov::clear(mapDictionaries_t& mapDictionaries, std::istream& in, std:
 
   if (firstDictionary != mapDictionaries.end() && secondDictionary != mapDictionaries.end())
   {
-    for (auto it = secondDictionary->second.begin(); it != secondDictionary->second.end(); ++it)
+    for (auto it = secondDictionary->second.cbegin(); it != secondDictionary->second.cend(); ++it)
     {
-      if (firstDictionary->second.find(it->first) != firstDictionary->second.end())
-      {
-        firstDictionary->second.erase(it->first);
-      }
+      firstDictionary->second.erase(it->first);
     }
     out << " All existing words in the '" << name2 << "' dictionary have been removed from the '" << name1 << "' dictionary\n";
   }
@@ -321,10 +438,15 @@ void nikiforov::writingDictionaries(const mapDictionaries_t& mapDictionaries, st
 {
   for (auto it = mapDictionaries.cbegin(); it != mapDictionaries.cend(); ++it)
   {
-    fout.open(nameMkdir + "\\" + it->first + ".txt");
+    // dictionaries opened from this folder are still mapped from the files about to be overwritten
+    it->second.cbegin();
+  }
+  for (auto it = mapDictionaries.cbegin(); it != mapDictionaries.cend(); ++it)
+  {
+    fout.open(nameMkdir + "/" + it->first + ".dict", std::ios::binary);
     if (fout.is_open())
     {
-      printWordAndFrequency(it->second.cbegin(), it->second.cend(), fout);
+      writeDictionary(fout, it->second.cbegin(), it->second.cend());
     }
     fout.close();
   }
@@ -372,10 +494,7 @@ void nikiforov::printDict(mapDictionaries_t& mapDictionaries, std::istream& in,
     else
     {
       out << " The contents of the dictionary '" << nameSelectedDictionary << "':\n";
-      for (auto iterPair = SelectedDictionary->second.begin(); iterPair != SelectedDictionary->second.end(); ++iterPair)
-      {
-        printWordAndFrequency(iterPair, out);
-      }
+      printWordAndFrequency(SelectedDictionary->second.cbegin(), SelectedDictionary->second.cend(), out);
     }
   }
   else
@@ -385,24 +504,16 @@ void nikiforov::printDict(mapDictionaries_t& mapDictionaries, std::istream& in,
   }
 }
 
-void nikiforov::printMost(nikiforov::AvlTree< std::string, size_t >& invertDictionary, std::istream& in, std::ostream& out)
+void nikiforov::printMost(const nikiforov::Dictionary& dictionary, std::istream& in, std::ostream& out)
 {
   size_t numOfTheMostFrequent = 0;
   in >> numOfTheMostFrequent;
   out << " The " << numOfTheMostFrequent << " most common words\n";
 
   size_t count = 0;
-  for (auto iterPair = invertDictionary.begin(); iterPair != invertDictionary.end(); ++iterPair)
+  for (auto iterPair = dictionary.mostBegin(); iterPair != dictionary.mostEnd() && count != numOfTheMostFrequent; ++iterPair)
   {
-    if (numOfTheMostFrequent != count++)
-    {
-      out << count << ". ";
-      printWordAndFrequency(iterPair, out);
-    }
-    else
-    {
-      break;
-    }
+    out << ++count << ". " << iterPair->second << " " << iterPair->first << "\n";
   }
 }
 
@@ -414,10 +525,10 @@ void nikiforov::find(mapDictionaries_t& mapDictionaries, std::istream& in, std::
     std::string enteredWord;
     in >> enteredWord;
 
-    auto iterPair = SelectedDictionary->second.find(enteredWord);
-    if (iterPair != SelectedDictionary->second.end())
+    size_t frequency = SelectedDictionary->second.getFrequency(enteredWord);
+    if (frequency != 0)
     {
-      printWordAndFrequency(iterPair, out);
+      out << enteredWord << " " << frequency << "\n";
     }
     else
     {
@@ -439,10 +550,8 @@ void nikiforov::erase(mapDictionaries_t& mapDictionaries, std::istream& in, std:
     std::string enteredWord;
     in >> enteredWord;
 
-    auto deletedWord = SelectedDictionary->second.find(enteredWord);
-    if (deletedWord != SelectedDictionary->second.end())
+    if (SelectedDictionary->second.erase(enteredWord))
     {
-      SelectedDictionary->second.erase(deletedWord->first);
       out << " The word '" << enteredWord << "' has been successfully deleted\n";
     }
     else
@@ -465,8 +574,3 @@ void nikiforov::printWordAndFrequency(AvlTreeConstIter begin, AvlTreeConstIter e
     begin++;
   }
 }
-
-void nikiforov::printWordAndFrequency(nikiforov::AvlTree< std::string, size_t >::Iterator iterPair, std::ostream& out)
-{
-  out << iterPair->first << " " << iterPair->second << "\n";
-}
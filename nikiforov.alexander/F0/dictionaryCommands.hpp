@@ -5,12 +5,13 @@
 #include <algorithm>
 #include <iostream>
 #include <string>
+#include <unordered_map>
 #include <commands.hpp>
+#include "dictionary.hpp"
 
 namespace nikiforov
 {
-  using mapDictionaries_t = nikiforov::AvlTree< std::string, nikiforov::AvlTree< std::string, size_t > >;
-  using invertedMap_t = std::multimap< size_t, std::string >;
+  using mapDictionaries_t = nikiforov::AvlTree< std::string, nikiforov::Dictionary >;
   using AvlTreeConstIter = nikiforov::AvlTree< std::string, size_t >::ConstIterator;
 
   void printCommands(std::ostream& out);
@@ -19,10 +20,13 @@ namespace nikiforov
 
   void createDict(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out, std::string mkdir);
   void getDictionary(nikiforov::AvlTree< std::string, size_t >& dictionary, std::istream& in);
+  void getDictionary(nikiforov::AvlTree< std::string, size_t >& dictionary, const char* first, const char* last);
+  void countWords(const char* first, const char* last, std::unordered_map< std::string, size_t >& words);
   void deleteDelimeters(std::string& str);
   bool checkAlpha(std::string& str);
 
   void open(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out);
+  bool hasExtension(const std::string& fileName, const std::string& extension);
 
   void deleteDict(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out);
 
@@ -41,11 +45,10 @@ namespace nikiforov
   void writingDictionaries(const mapDictionaries_t& mapDictionaries, std::string nameMkdir, std::ofstream& fout);
 
   void printWordAndFrequency(AvlTreeConstIter begin, AvlTreeConstIter end, std::ostream& out);
-  void printWordAndFrequency(nikiforov::AvlTree< std::string, size_t >::Iterator iterPair, std::ostream& out);
 
   void select(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out, std::string& nameSelectedDictionary);
   void printDict(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out, std::string nameSelectedDictionary);
-  void printMost(nikiforov::AvlTree< std::string, size_t >& invertedDictionary, std::istream& in, std::ostream& out);
+  void printMost(const nikiforov::Dictionary& dictionary, std::istream& in, std::ostream& out);
   void find(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out, std::string nameSelectedDictionary);
   void erase(mapDictionaries_t& mapDictionaries, std::istream& in, std::ostream& out, std::string nameSelectedDictionary);
 
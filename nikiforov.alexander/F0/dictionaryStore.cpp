@@ -0,0 +1,223 @@
+#include "dictionaryStore.hpp"
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <vector>
+
+namespace nikiforov
+{
+  const size_t wordsInBlock = 16;
+  const size_t fixedSize = 8;
+  const char dictionaryMagic[fixedSize] = { 'N', 'K', 'D', 'I', 'C', 'T', '1', '\0' };
+  const size_t headerSize = fixedSize * 4;
+}
+
+nikiforov::StoredDictionary::StoredDictionary(const std::string& fileName) :
+  file(fileName), isValid(false), countWords(0), countBlocks(0), index(nullptr)
+{
+  size_t fileSize = file.end() - file.begin();
+  if (!file.is_open() || fileSize < headerSize || std::memcmp(file.begin(), dictionaryMagic, fixedSize) != 0)
+  {
+    return;
+  }
+  countWords = readFixed(file.begin() + fixedSize);
+  countBlocks = readFixed(file.begin() + fixedSize * 2);
+  size_t indexOffset = readFixed(file.begin() + fixedSize * 3);
+  if (indexOffset < headerSize || indexOffset > fileSize || (fileSize - indexOffset) / fixedSize < countBlocks
+    || countBlocks != (countWords + wordsInBlock - 1) / wordsInBlock)
+  {
+    return;
+  }
+  index = file.begin() + indexOffset;
+  for (size_t i = 0; i < countBlocks; i++)
+  {
+    size_t offset = readFixed(index + i * fixedSize);
+    if (offset < headerSize || offset >= indexOffset)
+    {
+      return;
+    }
+  }
+  isValid = true;
+}
+
+bool nikiforov::StoredDictionary::is_valid() const noexcept
+{
+  return isValid;
+}
+
+size_t nikiforov::StoredDictionary::getSize() const noexcept
+{
+  return countWords;
+}
+
+size_t nikiforov::StoredDictionary::getFrequency(const std::string& word) const
+{
+  size_t left = 0;
+  size_t right = countBlocks;
+  while (left < right)
+  {
+    size_t middle = left + (right - left) / 2;
+    const char* pos = getBlock(middle);
+    size_t length = 0;
+    if (!readVarint(pos, index, length) || static_cast< size_t >(index - pos) < length)
+    {
+      return 0;
+    }
+    if (word.compare(0, std::string::npos, pos, length) < 0)
+    {
+      right = middle;
+    }
+    else
+    {
+      left = middle + 1;
+    }
+  }
+  if (left == 0)
+  {
+    return 0;
+  }
+
+  const char* pos = getBlock(left - 1);
+  size_t inBlock = std::min(wordsInBlock, countWords - (left - 1) * wordsInBlock);
+  std::string current;
+  for (size_t i = 0; i < inBlock; i++)
+  {
+    size_t prefix = 0;
+    size_t length = 0;
+    size_t frequency = 0;
+    if ((i != 0 && !readVarint(pos, index, prefix)) || !readVarint(pos, index, length)
+      || prefix > current.size() || static_cast< size_t >(index - pos) < length)
+    {
+      return 0;
+    }
+    current.resize(prefix);
+    current.append(pos, length);
+    pos += length;
+    if (!readVarint(pos, index, frequency))
+    {
+      return 0;
+    }
+    if (current == word)
+    {
+      return frequency;
+    }
+  }
+  return 0;
+}
+
+void nikiforov::StoredDictionary::load(AvlTree< std::string, size_t >& words) const
+{
+  std::vector< std::pair< std::string, size_t > > data;
+  data.reserve(countWords);
+  const char* pos = countBlocks == 0 ? index : getBlock(0);
+  std::string current;
+  for (size_t i = 0; i < countWords; i++)
+  {
+    size_t prefix = 0;
+    size_t length = 0;
+    size_t frequency = 0;
+    if ((i % wordsInBlock != 0 && !readVarint(pos, index, prefix)) || !readVarint(pos, index, length)
+      || prefix > current.size() || static_cast< size_t >(index - pos) < length)
+    {
+      break;
+    }
+    current.resize(prefix);
+    current.append(pos, length);
+    pos += length;
+    if (!readVarint(pos, index, frequency))
+    {
+      break;
+    }
+    data.emplace_back(current, frequency);
+  }
+  words.clear();
+  words.insertSorted(data.begin(), data.end());
+}
+
+const char* nikiforov::StoredDictionary::getBlock(size_t numBlock) const
+{
+  return file.begin() + readFixed(index + numBlock * fixedSize);
+}
+
+void nikiforov::writeDictionary(std::ostream& out, wordsConstIter first, wordsConstIter last)
+{
+  std::ostringstream blocks;
+  std::vector< size_t > offsets;
+  std::string previous;
+  size_t countWords = 0;
+  for (; first != last; ++first, ++countWords)
+  {
+    const std::string& word = first->first;
+    if (countWords % wordsInBlock == 0)
+    {
+      offsets.push_back(headerSize + static_cast< size_t >(blocks.tellp()));
+      writeVarint(blocks, word.size());
+      blocks.write(word.data(), word.size());
+    }
+    else
+    {
+      size_t common = std::min(previous.size(), word.size());
+      size_t prefix = std::mismatch(word.begin(), word.begin() + common, previous.begin()).first - word.begin();
+      writeVarint(blocks, prefix);
+      writeVarint(blocks, word.size() - prefix);
+      blocks.write(word.data() + prefix, word.size() - prefix);
+    }
+    writeVarint(blocks, first->second);
+    previous = word;
+  }
+
+  std::string body = blocks.str();
+  out.write(dictionaryMagic, fixedSize);
+  writeFixed(out, countWords);
+  writeFixed(out, offsets.size());
+  writeFixed(out, headerSize + body.size());
+  out.write(body.data(), body.size());
+  for (size_t offset : offsets)
+  {
+    writeFixed(out, offset);
+  }
+}
+
+void nikiforov::writeVarint(std::ostream& out, size_t value)
+{
+  while (value >= 0x80)
+  {
+    out.put(static_cast< char >((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  out.put(static_cast< char >(value));
+}
+
+void nikiforov::writeFixed(std::ostream& out, size_t value)
+{
+  for (size_t i = 0; i < fixedSize; i++)
+  {
+    out.put(static_cast< char >((value >> (8 * i)) & 0xFF));
+  }
+}
+
+bool nikiforov::readVarint(const char*& first, const char* last, size_t& value)
+{
+  value = 0;
+  for (size_t shift = 0; first != last && shift < 64; shift += 7)
+  {
+    unsigned char byte = static_cast< unsigned char >(*first++);
+    value |= static_cast< size_t >(byte & 0x7F) << shift;
+    if (!(byte & 0x80))
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t nikiforov::readFixed(const char* first)
+{
+  size_t value = 0;
+  for (size_t i = 0; i < fixedSize; i++)
+  {
+    value |= static_cast< size_t >(static_cast< unsigned char >(first[i])) << (8 * i);
+  }
+  return value;
+}
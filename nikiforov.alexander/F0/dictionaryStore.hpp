@@ -0,0 +1,39 @@
+#ifndef DICTIONARYSTORE_HPP
+#define DICTIONARYSTORE_HPP
+#include <iosfwd>
+#include <string>
+#include <AvlTree.hpp>
+#include "mappedFile.hpp"
+
+namespace nikiforov
+{
+  using wordsConstIter = AvlTree< std::string, size_t >::ConstIterator;
+
+  class StoredDictionary
+  {
+  public:
+    explicit StoredDictionary(const std::string& fileName);
+
+    bool is_valid() const noexcept;
+    size_t getSize() const noexcept;
+    size_t getFrequency(const std::string& word) const;
+    void load(AvlTree< std::string, size_t >& words) const;
+
+  private:
+    MappedFile file;
+    bool isValid;
+    size_t countWords;
+    size_t countBlocks;
+    const char* index;
+
+    const char* getBlock(size_t numBlock) const;
+  };
+
+  void writeDictionary(std::ostream& out, wordsConstIter first, wordsConstIter last);
+  void writeVarint(std::ostream& out, size_t value);
+  void writeFixed(std::ostream& out, size_t value);
+  bool readVarint(const char*& first, const char* last, size_t& value);
+  size_t readFixed(const char* first);
+}
+
+#endif
@@ -1,10 +1,11 @@
 #include <iostream>
 #include <functional>
+#include <limits>
 #include "dictionaryCommands.hpp"
 
 int main()
 {
-  using mapDictionaries_t = nikiforov::AvlTree< std::string, nikiforov::AvlTree< std::string, size_t > >;
+  using mapDictionaries_t = nikiforov::mapDictionaries_t;
 
   mapDictionaries_t mapDictionaries;
 
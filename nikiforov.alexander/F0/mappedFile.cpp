@@ -0,0 +1,58 @@
+#include "mappedFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+nikiforov::MappedFile::MappedFile(const std::string& fileName) :
+  data(nullptr), size(0), isOpen(false)
+{
+  int fd = ::open(fileName.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    return;
+  }
+  struct stat info = {};
+  if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+  {
+    size = info.st_size;
+    isOpen = true;
+    if (size != 0)
+    {
+      void* ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr == MAP_FAILED)
+      {
+        size = 0;
+        isOpen = false;
+      }
+      else
+      {
+        data = static_cast< const char* >(ptr);
+      }
+    }
+  }
+  ::close(fd);
+}
+
+nikiforov::MappedFile::~MappedFile()
+{
+  if (data)
+  {
+    munmap(const_cast< char* >(data), size);
+  }
+}
+
+bool nikiforov::MappedFile::is_open() const noexcept
+{
+  return isOpen;
+}
+
+const char* nikiforov::MappedFile::begin() const noexcept
+{
+  return data;
+}
+
+const char* nikiforov::MappedFile::end() const noexcept
+{
+  return data + size;
+}
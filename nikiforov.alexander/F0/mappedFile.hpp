@@ -0,0 +1,27 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+#include <string>
+
+namespace nikiforov
+{
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const std::string& fileName);
+    MappedFile(const MappedFile&) = delete;
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool is_open() const noexcept;
+    const char* begin() const noexcept;
+    const char* end() const noexcept;
+
+  private:
+    const char* data;
+    size_t size;
+    bool isOpen;
+  };
+}
+
+#endif
@@ -1,6 +1,9 @@
 #ifndef AvlTree_HPP
 #define AvlTree_HPP
 #include <iostream>
+#include <iterator>
+#include <utility>
+#include <vector>
 #include "queue.hpp"
 #include "stack.hpp"
 
@@ -23,6 +26,8 @@ namespace nikiforov
     AvlTree(const AvlTree& other);
     AvlTree(AvlTree&& other);
     AvlTree(std::initializer_list< keyValue_t > list);
+    template< typename InputIt1, typename InputIt2, typename Merge >
+    AvlTree(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Merge merge);
     ~AvlTree();
 
     AvlTree& operator=(AvlTree other);
@@ -38,13 +43,17 @@ namespace nikiforov
     Value& at(const Key& key);
 
     Iterator emplace(const Key& key, const Value& value);
+    Iterator emplace(const Key& key, Value&& value);
     void insert(const keyValue_t& data);
+    template< typename InputIt >
+    void insertSorted(InputIt first, InputIt last);
     void erase(Iterator pos);
     size_t erase(const Key& k);
     void swap(AvlTree& other);
     void clear();
 
     Iterator find(const Key& key);
+    ConstIterator find(const Key& key) const;
     std::pair< Iterator, Iterator > equalRange(const Key& key);
 
     template< typename F >
@@ -69,7 +78,7 @@ namespace nikiforov
         right(nullptr),
         left(nullptr),
         parent(nullptr),
-        data(data)
+        data(std::move(data))
       {}
     };
 
@@ -82,7 +91,8 @@ namespace nikiforov
     Node* rotationRL(Node* pNode);
     Node* rotationLR(Node* pNode);
 
-    Node* insertData(Node* pNode, const Key& key, const Value& value);
+    Node* insertData(Node* pNode, keyValue_t& data);
+    Node* buildBalanced(const keyValue_t* first, const keyValue_t* last, Node* parent);
     size_t countSize(Node* pNode) const;
     size_t getHeight(Node* pNode);
     int heightDiff(Node* pNode);
@@ -626,6 +636,7 @@ nikiforov::AvlTree<Key, Value, Compare>::AvlTree(AvlTree&& other) :
   pRoot(std::move(other.pRoot)), size(std::move(other.size))
 {
   other.pRoot = nullptr;
+  other.size = 0;
 }
 
 template< typename Key, typename Value, typename Compare >
@@ -637,6 +648,43 @@ nikiforov::AvlTree< Key, Value, Compare >::AvlTree(std::initializer_list< keyVal
   }
 }
 
+template< typename Key, typename Value, typename Compare >
+template< typename InputIt1, typename InputIt2, typename Merge >
+nikiforov::AvlTree< Key, Value, Compare >::AvlTree(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Merge merge) :
+  pRoot(nullptr), size(0)
+{
+  std::vector< keyValue_t > data;
+  while (first1 != last1 && first2 != last2)
+  {
+    if (cmp(first1->first, first2->first))
+    {
+      data.push_back(*first1);
+      ++first1;
+    }
+    else if (cmp(first2->first, first1->first))
+    {
+      data.push_back(*first2);
+      ++first2;
+    }
+    else
+    {
+      data.emplace_back(first1->first, merge(first1->second, first2->second));
+      ++first1;
+      ++first2;
+    }
+  }
+  for (; first1 != last1; ++first1)
+  {
+    data.push_back(*first1);
+  }
+  for (; first2 != last2; ++first2)
+  {
+    data.push_back(*first2);
+  }
+  pRoot = buildBalanced(data.data(), data.data() + data.size(), nullptr);
+  size = data.size();
+}
+
 template< typename Key, typename Value, typename Compare >
 nikiforov::AvlTree< Key, Value, Compare >::~AvlTree()
 {
@@ -724,7 +772,18 @@ template < typename Key, typename Value, typename Compare >
 typename nikiforov::AvlTree<Key, Value, Compare>::Iterator
 nikiforov::AvlTree< Key, Value, Compare >::emplace(const Key& key, const Value& value)
 {
-  pRoot = insertData(pRoot, key, value);
+  keyValue_t data(key, value);
+  pRoot = insertData(pRoot, data);
+  size++;
+  return find(key);
+}
+
+template < typename Key, typename Value, typename Compare >
+typename nikiforov::AvlTree<Key, Value, Compare>::Iterator
+nikiforov::AvlTree< Key, Value, Compare >::emplace(const Key& key, Value&& value)
+{
+  keyValue_t data(key, std::move(value));
+  pRoot = insertData(pRoot, data);
   size++;
   return find(key);
 }
@@ -732,10 +791,28 @@ nikiforov::AvlTree< Key, Value, Compare >::emplace(const Key& key, const Value&
 template< typename Key, typename Value, typename Compare >
 void nikiforov::AvlTree<Key, Value, Compare>::insert(const keyValue_t& data)
 {
-  pRoot = insertData(pRoot, data.first, data.second);
+  keyValue_t copy(data);
+  pRoot = insertData(pRoot, copy);
   size++;
 }
 
+template< typename Key, typename Value, typename Compare >
+template< typename InputIt >
+void nikiforov::AvlTree< Key, Value, Compare >::insertSorted(InputIt first, InputIt last)
+{
+  if (!is_empty())
+  {
+    for (; first != last; ++first)
+    {
+      insert(*first);
+    }
+    return;
+  }
+  std::vector< keyValue_t > data(first, last);
+  pRoot = buildBalanced(data.data(), data.data() + data.size(), nullptr);
+  size = data.size();
+}
+
 template< typename Key, typename Value, typename Compare >
 void nikiforov::AvlTree< Key, Value, Compare >::erase(Iterator pos)
 {
@@ -762,9 +839,9 @@ size_t nikiforov::AvlTree< Key, Value, Compare >::erase(const Key& key)
 template<typename Key, typename Value, typename Compare>
 void nikiforov::AvlTree<Key, Value, Compare>::swap(AvlTree& other)
 {
-  Node* otherRoot = other.pRoot;
-  other.pRoot = pRoot;
-  pRoot = otherRoot;
+  std::swap(pRoot, other.pRoot);
+  std::swap(size, other.size);
+  std::swap(cmp, other.cmp);
 }
 
 template<typename Key, typename Value, typename Compare>
@@ -797,6 +874,28 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Iterator nikiforov::AvlTree<
   return end();
 }
 
+template< typename Key, typename Value, typename Compare >
+typename nikiforov::AvlTree< Key, Value, Compare >::ConstIterator nikiforov::AvlTree< Key, Value, Compare >::find(const Key& key) const
+{
+  Node* actualRoot = pRoot;
+  while (actualRoot)
+  {
+    if (actualRoot->data.first == key)
+    {
+      return ConstIterator(actualRoot);
+    }
+    else if (cmp(actualRoot->data.first, key))
+    {
+      actualRoot = actualRoot->right;
+    }
+    else
+    {
+      actualRoot = actualRoot->left;
+    }
+  }
+  return cend();
+}
+
 template < typename Key, typename Value, typename Compare >
 using pairIters = std::pair<
   typename nikiforov::AvlTree< Key, Value, Compare >::Iterator,
@@ -942,28 +1041,44 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree< Ke
 
 template< typename Key, typename Value, typename Compare >
 typename nikiforov::AvlTree<Key, Value, Compare>::Node*
-nikiforov::AvlTree<Key, Value, Compare>::insertData(Node* pNode, const Key& key, const Value& value)
+nikiforov::AvlTree<Key, Value, Compare>::insertData(Node* pNode, keyValue_t& data)
 {
   if (pNode == nullptr)
   {
-    pNode = new Node(std::make_pair(key, value));
+    pNode = new Node(std::move(data));
   }
   else
   {
-    if (cmp(pNode->data.first, key))
+    if (cmp(pNode->data.first, data.first))
     {
-      pNode->right = insertData(pNode->right, key, value);
+      pNode->right = insertData(pNode->right, data);
       pNode->right->parent = pNode;
     }
     else
     {
-      pNode->left = insertData(pNode->left, key, value);
+      pNode->left = insertData(pNode->left, data);
       pNode->left->parent = pNode;
     }
   }
   return balance(pNode);
 }
 
+template< typename Key, typename Value, typename Compare >
+typename nikiforov::AvlTree< Key, Value, Compare >::Node*
+nikiforov::AvlTree< Key, Value, Compare >::buildBalanced(const keyValue_t* first, const keyValue_t* last, Node* parent)
+{
+  if (first == last)
+  {
+    return nullptr;
+  }
+  const keyValue_t* middle = first + (last - first) / 2;
+  Node* pNode = new Node(*middle);
+  pNode->parent = parent;
+  pNode->left = buildBalanced(first, middle, pNode);
+  pNode->right = buildBalanced(middle + 1, last, pNode);
+  return pNode;
+}
+
 template< typename Key, typename Value, typename Compare >
 size_t nikiforov::AvlTree<Key, Value, Compare>::countSize(Node* pNode) const
 {
@@ -1049,17 +1164,12 @@ typename nikiforov::AvlTree< Key, Value, Compare >::Node* nikiforov::AvlTree<Key
     if (pNode->left == nullptr || pNode->right == nullptr)
     {
       Node* actual = pNode->left ? pNode->left : pNode->right;
-
-      if (actual == nullptr)
-      {
-        actual = pNode;
-        pNode = nullptr;
-      }
-      else
+      if (actual != nullptr)
       {
-        *pNode = *actual;
+        actual->parent = pNode->parent;
       }
-      delete actual;
+      delete pNode;
+      return actual;
     }
     else
     {
@@ -36,6 +36,7 @@ void ponomarev::getText(std::istream & input, HuffmanCode & data)
   }
 
   data.text = text;
+  data.textFiles.clear();
 }
 
 void ponomarev::cutTextInFile(long long n, long long k, HuffmanCode & data, std::istream & input)
@@ -57,6 +58,7 @@ void ponomarev::cutTextInFile(long long n, long long k, HuffmanCode & data, std:
   {
     text = text.substr(n, (k - n));
     data.text = text;
+    data.textFiles.clear();
   }
 }
 
@@ -3,7 +3,7 @@
 #include <iostream>
 #include "accessoryFunctions.hpp"
 
-ponomarev::MinHeapNode::MinHeapNode(char data, int freq)
+ponomarev::MinHeapNode::MinHeapNode(char data, size_t freq)
 {
   left = right = nullptr;
   this->data = data;
@@ -19,8 +19,10 @@ ponomarev::HuffmanCode::HuffmanCode():
   codes(),
   freq(),
   text(),
+  textFiles(),
   decodingText(),
-  minHeap()
+  minHeap(),
+  nodes()
 {}
 
 void ponomarev::printCodes(MinHeapNode * root, std::string str)
@@ -64,19 +66,30 @@ void ponomarev::storeCodes(MinHeapNode * root, std::string str, HuffmanCode & da
 
 void ponomarev::createTree(HuffmanCode & data)
 {
-    MinHeapNode * left, * right, * top;
+    size_t count = data.freq.getSize();
+    if (count == 0)
+    {
+        throw std::logic_error("no frequencies to build the tree");
+    }
 
-    for (BSTree < char, int, int >::Iterator v = data.freq.begin(); v != data.freq.end(); v++)
+    data.minHeap.clear();
+    data.nodes.reset(2 * count - 1);
+    MinHeapNode * leaves[256];
+    size_t i = 0;
+    for (BSTree < char, size_t, int >::Iterator v = data.freq.begin(); v != data.freq.end(); v++)
     {
-        data.minHeap.push(new MinHeapNode(v->first, v->second));
+        leaves[i++] = data.nodes.create(v->first, v->second);
     }
+    data.minHeap.heapify(leaves, leaves + count);
+
+    MinHeapNode * left, * right, * top;
     while (data.minHeap.getSize() != 1)
     {
         left = data.minHeap.getElem();
         data.minHeap.pop();
         right = data.minHeap.getElem();
         data.minHeap.pop();
-        top = new MinHeapNode('$', left->freq + right->freq);
+        top = data.nodes.create('$', left->freq + right->freq);
         top->left = left;
         top->right = right;
         data.minHeap.push(top);
@@ -93,6 +106,66 @@ void ponomarev::calcFreq(std::string str, HuffmanCode & data)
     }
 }
 
+void ponomarev::calcFreq(std::istream & input, std::ostream * out, HuffmanCode & data)
+{
+  const std::streamsize bufferSize = 65536;
+  char buffer[bufferSize];
+  size_t counts[256] = {};
+
+  while (input.read(buffer, bufferSize) || input.gcount() > 0)
+  {
+    std::streamsize count = input.gcount();
+    for (std::streamsize i = 0; i < count; i++)
+    {
+      counts[static_cast< unsigned char >(buffer[i])]++;
+    }
+    if (out && !out->write(buffer, count))
+    {
+      throw std::logic_error("can't write the file");
+    }
+  }
+
+  for (size_t i = 0; i < 256; i++)
+  {
+    if (counts[i] != 0)
+    {
+      data.freq[static_cast< char >(i)] += counts[i];
+    }
+  }
+}
+
+void ponomarev::encodeText(std::istream & input, std::ostream & out, HuffmanCode & data)
+{
+  const std::streamsize bufferSize = 65536;
+  char buffer[bufferSize];
+  std::string table[256];
+  for (BSTree < char, std::string, int >::Iterator v = data.codes.begin(); v != data.codes.end(); v++)
+  {
+    table[static_cast< unsigned char >(v->first)] = v->second;
+  }
+
+  std::string encoded = "";
+  encoded.reserve(2 * bufferSize);
+  while (input.read(buffer, bufferSize) || input.gcount() > 0)
+  {
+    std::streamsize count = input.gcount();
+    for (std::streamsize i = 0; i < count; i++)
+    {
+      encoded += table[static_cast< unsigned char >(buffer[i])];
+      if (encoded.size() >= static_cast< size_t >(bufferSize))
+      {
+        out.write(encoded.data(), encoded.size());
+        encoded.clear();
+      }
+    }
+  }
+  out.write(encoded.data(), encoded.size());
+  if (!out)
+  {
+    throw std::logic_error("can't write the file");
+  }
+}
+
 void ponomarev::decodeFile(HuffmanCode & data)
 {
     MinHeapNode * root = data.minHeap.getElem();
@@ -117,6 +190,7 @@ void ponomarev::decodeFile(HuffmanCode & data)
       }
     }
     data.text = ans;
+    data.textFiles.clear();
 }
 
 void ponomarev::makeEncode(HuffmanCode & data)
@@ -140,6 +214,58 @@ void ponomarev::makeEncode(HuffmanCode & data)
   }
 }
 
+void ponomarev::makeEncode(const List< std::string > & files, std::ostream * out, HuffmanCode & data)
+{
+  data.freq.clear();
+  data.codes.clear();
+  for (List< std::string >::const_iterator file = files.cbegin(); file != files.cend(); file++)
+  {
+    std::ifstream input(*file, std::ios_base::binary);
+    if (!input)
+    {
+      throw std::logic_error("can't open the file");
+    }
+    ponomarev::calcFreq(input, out, data);
+  }
+
+  if (data.freq.isEmpty())
+  {
+    ponomarev::printInvalidEncodeMessage(std::cout);
+    return;
+  }
+  ponomarev::createTree(data);
+  ponomarev::printSuccessfullyEncodeMessage(std::cout);
+}
+
+void ponomarev::encodeFile(const std::string & fileIn, const std::string & fileOut, HuffmanCode & data)
+{
+  std::ifstream input(fileIn, std::ios_base::binary);
+  if (!input)
+  {
+    throw std::logic_error("can't open the file");
+  }
+
+  data.freq.clear();
+  data.codes.clear();
+  ponomarev::calcFreq(input, nullptr, data);
+  if (data.freq.isEmpty())
+  {
+    ponomarev::printInvalidEncodeMessage(std::cout);
+    return;
+  }
+  ponomarev::createTree(data);
+
+  std::ofstream out(fileOut, std::ios_base::binary);
+  if (!out)
+  {
+    throw std::logic_error("can't open the file");
+  }
+  input.clear();
+  input.seekg(0, std::ios_base::beg);
+  ponomarev::encodeText(input, out, data);
+  ponomarev::printSuccessfullyEncodeMessage(std::cout);
+}
+
 void ponomarev::fillFreq(std::string parameter, HuffmanCode & data)
 {
   std::ifstream input(parameter);
@@ -153,8 +279,42 @@ void ponomarev::fillFreq(std::string parameter, HuffmanCode & data)
   while (input >> str)
   {
     char symbol = cutType(str)[0];
-    int freq = std::stoi(str);
+    size_t freq = std::stoull(str);
     data.freq[symbol] = freq;
   }
   ponomarev::printSuccessfullyFrequenceInput(std::cout);
 }
+
+bool ponomarev::isTextFile(const std::string & fileName, const HuffmanCode & data)
+{
+  for (List< std::string >::const_iterator file = data.textFiles.cbegin(); file != data.textFiles.cend(); file++)
+  {
+    if (*file == fileName)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ponomarev::writeText(std::ostream & out, const HuffmanCode & data)
+{
+  if (data.textFiles.isEmpty())
+  {
+    out << data.text;
+    return;
+  }
+
+  for (List< std::string >::const_iterator file = data.textFiles.cbegin(); file != data.textFiles.cend(); file++)
+  {
+    std::ifstream input(*file, std::ios_base::binary);
+    if (!input)
+    {
+      throw std::logic_error("can't open the file");
+    }
+    if (input.peek() != std::ifstream::traits_type::eof())
+    {
+      out << input.rdbuf();
+    }
+  }
+}
@@ -1,19 +1,21 @@
 #ifndef CODING_HUFFMAN_HPP
 #define CODING_HUFFMAN_HPP
 
+#include <iosfwd>
 #include <string>
 #include "list.hpp"
-#include "queue.hpp"
+#include "heap.hpp"
+#include "arena.hpp"
 #include "binarySearchTreeAVL.hpp"
 
 namespace ponomarev
 {
   struct MinHeapNode
   {
-    MinHeapNode(char data, int freq);
+    MinHeapNode(char data, size_t freq);
 
     char data;
-    int freq;
+    size_t freq;
     MinHeapNode * left, * right;
   };
 
@@ -28,10 +30,12 @@ namespace ponomarev
     HuffmanCode();
 
     BSTree < char, std::string, int > codes;
-    BSTree < char, int, int > freq;
+    BSTree < char, size_t, int > freq;
     std::string text;
+    List< std::string > textFiles;
     std::string decodingText;
-    Queue < MinHeapNode * > minHeap;
+    Heap< MinHeapNode *, Compare > minHeap;
+    Arena< MinHeapNode > nodes;
     List< std::string > fileNames;
   };
 
@@ -39,9 +43,15 @@ namespace ponomarev
   void storeCodes(MinHeapNode * root, std::string str, HuffmanCode & data);
   void createTree(HuffmanCode & data);
   void calcFreq(std::string str, HuffmanCode & data);
+  void calcFreq(std::istream & input, std::ostream * out, HuffmanCode & data);
+  void encodeText(std::istream & input, std::ostream & out, HuffmanCode & data);
   void decodeFile(HuffmanCode & data);
   void makeEncode(HuffmanCode & data);
+  void makeEncode(const List< std::string > & files, std::ostream * out, HuffmanCode & data);
+  void encodeFile(const std::string & fileIn, const std::string & fileOut, HuffmanCode & data);
   void fillFreq(std::string parameter, HuffmanCode & data);
+  bool isTextFile(const std::string & fileName, const HuffmanCode & data);
+  void writeText(std::ostream & out, const HuffmanCode & data);
 }
 
 #endif
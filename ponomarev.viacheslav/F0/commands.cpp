@@ -15,21 +15,25 @@ void ponomarev::outputInfoAboutCommands(const std::string & parameters, ponomare
     std::cout << "------------------------------------------------------------------------\n";
     std::cout << "3) 'encode' - encoding of text entered from standard input\n";
     std::cout << "4) 'encode <filename>' - encoding of text in the filename\n";
-    std::cout << "5) 'encode <n> <k> <filename>' - encoding of text in the filename from the n character to the k\n";
-    std::cout << "6) 'write <filename>' - write the text entered from the standard input in filename\n";
+    std::cout << "5) 'encode <filename> <output>' - encoding of text in the filename, ";
+    std::cout << "the encoded text is written into output\n";
+    std::cout << "6) 'encode <n> <k> <filename>' - encoding of text in the filename from the n character to the k\n";
+    std::cout << "7) 'write <filename>' - write the text entered from the standard input ";
+    std::cout << "or the last encoded files in filename\n";
     std::cout << "------------------------------------------------------------------------\n";
-    std::cout << "7) 'set decode <filename>' - set the frequency table for decoding the file\n";
-    std::cout << "8) 'combine <filename1> <filename2> <filename3> ' - merge data from filename1 and filename2 into filename3\n";
-    std::cout << "9) 'decode <filename1> <filename2>' - decode the text contained in filename1 ";
+    std::cout << "8) 'set decode <filename>' - set the frequency table for decoding the file\n";
+    std::cout << "9) 'combine <filename1> ... <filenameN> <output>' - merge data from the files into output ";
+    std::cout << "and encode it as one text\n";
+    std::cout << "10) 'decode <filename1> <filename2>' - decode the text contained in filename1 ";
     std::cout << "using the frequency table specified in filename2\n";
     std::cout << "------------------------------------------------------------------------\n";
-    std::cout << "10) 'delete <n> <k> <filename> ' - deleting characters n through k in filename\n";
-    std::cout << "11) 'delete <filename> ' - delete a file\n";
-    std::cout << "12) 'clean <filename1>  <filename2> … <filenameN>' - delete all files\n";
-    std::cout << "13) 'clean <filename>' - clear the contents of the file\n";
+    std::cout << "11) 'delete <n> <k> <filename> ' - deleting characters n through k in filename\n";
+    std::cout << "12) 'delete <filename> ' - delete a file\n";
+    std::cout << "13) 'clean <filename1>  <filename2> … <filenameN>' - delete all files\n";
+    std::cout << "14) 'clean <filename>' - clear the contents of the file\n";
     std::cout << "------------------------------------------------------------------------\n";
-    std::cout << "14) 'table' - output of the character encoding table for the encoding result\n";
-    std::cout << "15) 'save <filename>' - saving the result of the work to a new txt file filename\n";
+    std::cout << "15) 'table' - output of the character encoding table for the encoding result\n";
+    std::cout << "16) 'save <filename>' - saving the result of the work to a new txt file filename\n";
     std::cout << "------------------------------------------------------------------------\n";
   }
   else
@@ -60,18 +64,25 @@ void ponomarev::chooseEncode(std::string & parameters, HuffmanCode & data)
     std::string parameter = cutType(parameters);
     if (!isNum(parameter))
     {
-      std::ifstream input(parameter);
-      if (!input)
-      {
-        throw std::logic_error("can't open the file");
-      }
-      else if (!parameters.empty())
+      std::string fileOut = cutType(parameters);
+      if (!parameters.empty() || fileOut == parameter)
       {
         throw std::logic_error("error: wrong parameters");
       }
 
-      ponomarev::getText(input, data);
-      ponomarev::makeEncode(data);
+      if (fileOut.empty())
+      {
+        List< std::string > files;
+        files.pushBack(parameter);
+        ponomarev::makeEncode(files, nullptr, data);
+      }
+      else
+      {
+        ponomarev::encodeFile(parameter, fileOut, data);
+      }
+      data.text.clear();
+      data.textFiles.clear();
+      data.textFiles.pushBack(parameter);
     }
     else
     {
@@ -103,7 +114,7 @@ void ponomarev::writeTextIntoFile(std::string & parameters, HuffmanCode & data)
 {
   std::string parameter = cutType(parameters);
 
-  if (!parameters.empty())
+  if (!parameters.empty() || ponomarev::isTextFile(parameter, data))
   {
     throw std::logic_error("error: wrong parameters");
   }
@@ -115,7 +126,7 @@ void ponomarev::writeTextIntoFile(std::string & parameters, HuffmanCode & data)
   }
 
   data.fileNames.pushBack(parameter);
-  fout << data.text;
+  ponomarev::writeText(fout, data);
   ponomarev::printSuccessfullyWriteMessage(std::cout);
 }
 
@@ -138,27 +149,44 @@ void ponomarev::setDecode(std::string & parameters, HuffmanCode & data)
   ponomarev::fillFreq(parameter, data);
 }
 
-void ponomarev::combineFiles(std::string & parameters, HuffmanCode &)
+void ponomarev::combineFiles(std::string & parameters, HuffmanCode & data)
 {
-  std::string file1 = cutType(parameters);
-  std::string file2 = cutType(parameters);
-  std::string file3 = cutType(parameters);
+  List< std::string > files;
+  std::string fileOut = cutType(parameters);
+  while (!parameters.empty())
+  {
+    files.pushBack(fileOut);
+    fileOut = cutType(parameters);
+  }
 
-  if (!parameters.empty())
+  if (files.isEmpty() || fileOut.empty())
   {
     throw std::logic_error("error: wrong parameters");
   }
 
-  std::ifstream if_a(file1, std::ios_base::binary);
-  std::ifstream if_b(file2, std::ios_base::binary);
-  std::ofstream of_c(file3, std::ios_base::binary);
+  for (List< std::string >::const_iterator file = files.cbegin(); file != files.cend(); file++)
+  {
+    if (file->empty() || *file == fileOut)
+    {
+      throw std::logic_error("error: wrong parameters");
+    }
+    std::ifstream input(*file, std::ios_base::binary);
+    if (!input)
+    {
+      throw std::logic_error("can't open the file");
+    }
+  }
 
-  if (!if_a || !if_b || !of_c)
+  std::ofstream out(fileOut, std::ios_base::binary);
+  if (!out)
   {
     throw std::logic_error("can't open the file");
   }
-
-  of_c << if_a.rdbuf() << if_b.rdbuf();
+  ponomarev::makeEncode(files, &out, data);
+  out.close();
+  data.text.clear();
+  data.textFiles.clear();
+  data.textFiles.pushBack(fileOut);
 }
 
 void ponomarev::showTable(std::string & parameters, HuffmanCode & data)
@@ -262,12 +290,13 @@ void ponomarev::makeSave(std::string & parameters, HuffmanCode & data)
 {
   std::string parameter = ponomarev::cutType(parameters);
 
-  if (parameters.empty())
+  if (parameters.empty() || ponomarev::isTextFile(parameter, data))
   {
     throw std::logic_error("error: wrong parameters");
   }
 
   std::ofstream out(parameter);
   data.fileNames.pushBack(parameter);
-  out << data.text << "\n" << data.decodingText;
+  ponomarev::writeText(out, data);
+  out << "\n" << data.decodingText;
 }
@@ -10,7 +10,7 @@ namespace ponomarev
   void chooseEncode(std::string & parameters, HuffmanCode & data);
   void writeTextIntoFile(std::string & parameters, HuffmanCode & data);
   void setDecode(std::string & parameters, HuffmanCode & data);
-  void combineFiles(std::string & parameters, HuffmanCode &);
+  void combineFiles(std::string & parameters, HuffmanCode & data);
   void showTable(std::string & parameters, HuffmanCode & data);
   void makeDecode(std::string & parameters, HuffmanCode & data);
   void makeClean(std::string & parameters, HuffmanCode & data);
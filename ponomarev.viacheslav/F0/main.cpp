@@ -1,4 +1,3 @@
-#include <limits>
 #include <functional>
 #include <iostream>
 #include "commands.hpp"
@@ -26,8 +25,12 @@ int main()
   std::string type = "";
   ponomarev::HuffmanCode data;
 
-  while (std::cin >> command)
+  while (std::getline(std::cin, command))
   {
+    if (command.empty())
+    {
+      continue;
+    }
     type = ponomarev::cutType(command);
     try
     {
@@ -36,8 +39,6 @@ int main()
     catch (const std::logic_error &)
     {
       ponomarev::printInvalidCommandMessage(std::cout);
-      std::cin.clear();
-      std::cin.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     }
   }
 
@@ -0,0 +1,136 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ponomarev
+{
+  template < typename T >
+  class Arena {
+  public:
+    Arena();
+    explicit Arena(size_t capacity);
+    Arena(const Arena & other) = delete;
+    Arena(Arena && other) noexcept;
+    ~Arena();
+
+    Arena & operator=(const Arena & other) = delete;
+    Arena & operator=(Arena && other) noexcept;
+
+    template < typename... Args >
+    T * create(Args &&... args);
+
+    size_t getSize() const noexcept;
+    size_t getCapacity() const noexcept;
+
+    void reset(size_t capacity);
+    void clear() noexcept;
+    void swap(Arena & other) noexcept;
+
+  private:
+    T * data_;
+    size_t size_;
+    size_t capacity_;
+  };
+}
+
+template < typename T >
+ponomarev::Arena< T >::Arena():
+  data_(nullptr),
+  size_(0),
+  capacity_(0)
+{}
+
+template < typename T >
+ponomarev::Arena< T >::Arena(size_t capacity):
+  data_(static_cast< T * >(::operator new(capacity * sizeof(T)))),
+  size_(0),
+  capacity_(capacity)
+{}
+
+template < typename T >
+ponomarev::Arena< T >::Arena(Arena && other) noexcept:
+  data_(other.data_),
+  size_(other.size_),
+  capacity_(other.capacity_)
+{
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+template < typename T >
+ponomarev::Arena< T >::~Arena()
+{
+  clear();
+  ::operator delete(data_);
+}
+
+template < typename T >
+ponomarev::Arena< T > & ponomarev::Arena< T >::operator=(Arena && other) noexcept
+{
+  if (this != &other)
+  {
+    Arena temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
+template < typename T >
+template < typename... Args >
+T * ponomarev::Arena< T >::create(Args &&... args)
+{
+  if (size_ == capacity_)
+  {
+    throw std::length_error("arena is full");
+  }
+  T * result = new (data_ + size_) T(std::forward< Args >(args)...);
+  size_++;
+  return result;
+}
+
+template < typename T >
+size_t ponomarev::Arena< T >::getSize() const noexcept
+{
+  return size_;
+}
+
+template < typename T >
+size_t ponomarev::Arena< T >::getCapacity() const noexcept
+{
+  return capacity_;
+}
+
+template < typename T >
+void ponomarev::Arena< T >::reset(size_t capacity)
+{
+  clear();
+  if (capacity > capacity_)
+  {
+    Arena temp(capacity);
+    swap(temp);
+  }
+}
+
+template < typename T >
+void ponomarev::Arena< T >::clear() noexcept
+{
+  for (size_t i = 0; i < size_; i++)
+  {
+    data_[i].~T();
+  }
+  size_ = 0;
+}
+
+template < typename T >
+void ponomarev::Arena< T >::swap(Arena & other) noexcept
+{
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+}
+
+#endif
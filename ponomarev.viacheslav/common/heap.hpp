@@ -0,0 +1,309 @@
+#ifndef HEAP_HPP
+#define HEAP_HPP
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ponomarev
+{
+  template < typename T, typename Compare = std::less< T >, size_t D = 4 >
+  class Heap {
+  public:
+    Heap();
+    explicit Heap(Compare comp);
+    Heap(const Heap & other);
+    Heap(Heap && other) noexcept;
+    template < typename InputIt >
+    Heap(InputIt first, InputIt last, Compare comp = Compare());
+    ~Heap();
+
+    Heap & operator=(const Heap & other);
+    Heap & operator=(Heap && other) noexcept;
+
+    const T & getElem() const;
+
+    bool isEmpty() const noexcept;
+    size_t getSize() const noexcept;
+
+    void reserve(size_t capacity);
+    void push(const T & value);
+    void push(T && value);
+    void pop();
+    void decreaseKey(size_t pos, const T & value);
+    template < typename InputIt >
+    void heapify(InputIt first, InputIt last);
+    void clear() noexcept;
+    void swap(Heap & other) noexcept;
+
+  private:
+    T * data_;
+    size_t size_;
+    size_t capacity_;
+    Compare comp_;
+
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+  };
+}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D >::Heap():
+  Heap(Compare())
+{}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D >::Heap(Compare comp):
+  data_(nullptr),
+  size_(0),
+  capacity_(0),
+  comp_(comp)
+{
+  static_assert(D >= 2, "heap arity must be at least 2");
+}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D >::Heap(const Heap & other):
+  Heap(other.comp_)
+{
+  reserve(other.size_);
+  for (size_t i = 0; i < other.size_; i++)
+  {
+    new (data_ + i) T(other.data_[i]);
+    size_++;
+  }
+}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D >::Heap(Heap && other) noexcept:
+  data_(other.data_),
+  size_(other.size_),
+  capacity_(other.capacity_),
+  comp_(std::move(other.comp_))
+{
+  other.data_ = nullptr;
+  other.size_ = 0;
+  other.capacity_ = 0;
+}
+
+template < typename T, typename Compare, size_t D >
+template < typename InputIt >
+ponomarev::Heap< T, Compare, D >::Heap(InputIt first, InputIt last, Compare comp):
+  Heap(comp)
+{
+  heapify(first, last);
+}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D >::~Heap()
+{
+  clear();
+  ::operator delete(data_);
+}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D > & ponomarev::Heap< T, Compare, D >::operator=(const Heap & other)
+{
+  if (this != &other)
+  {
+    Heap temp(other);
+    swap(temp);
+  }
+  return *this;
+}
+
+template < typename T, typename Compare, size_t D >
+ponomarev::Heap< T, Compare, D > & ponomarev::Heap< T, Compare, D >::operator=(Heap && other) noexcept
+{
+  if (this != &other)
+  {
+    Heap temp(std::move(other));
+    swap(temp);
+  }
+  return *this;
+}
+
+template < typename T, typename Compare, size_t D >
+const T & ponomarev::Heap< T, Compare, D >::getElem() const
+{
+  if (isEmpty())
+  {
+    throw std::logic_error("heap is empty");
+  }
+  return data_[0];
+}
+
+template < typename T, typename Compare, size_t D >
+bool ponomarev::Heap< T, Compare, D >::isEmpty() const noexcept
+{
+  return size_ == 0;
+}
+
+template < typename T, typename Compare, size_t D >
+size_t ponomarev::Heap< T, Compare, D >::getSize() const noexcept
+{
+  return size_;
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::reserve(size_t capacity)
+{
+  if (capacity <= capacity_)
+  {
+    return;
+  }
+  T * newData = static_cast< T * >(::operator new(capacity * sizeof(T)));
+  for (size_t i = 0; i < size_; i++)
+  {
+    new (newData + i) T(std::move_if_noexcept(data_[i]));
+    data_[i].~T();
+  }
+  ::operator delete(data_);
+  data_ = newData;
+  capacity_ = capacity;
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::push(const T & value)
+{
+  push(T(value));
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::push(T && value)
+{
+  if (size_ == capacity_)
+  {
+    reserve(capacity_ == 0 ? D : capacity_ * 2);
+  }
+  new (data_ + size_) T(std::move(value));
+  siftUp(size_++);
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::pop()
+{
+  if (isEmpty())
+  {
+    throw std::logic_error("heap is empty");
+  }
+  --size_;
+  if (size_ != 0)
+  {
+    data_[0] = std::move(data_[size_]);
+  }
+  data_[size_].~T();
+  if (size_ != 0)
+  {
+    siftDown(0);
+  }
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::decreaseKey(size_t pos, const T & value)
+{
+  if (pos >= size_)
+  {
+    throw std::out_of_range("no such element in heap");
+  }
+  if (comp_(value, data_[pos]))
+  {
+    throw std::logic_error("new key is worse than the current one");
+  }
+  data_[pos] = value;
+  siftUp(pos);
+}
+
+template < typename T, typename Compare, size_t D >
+template < typename InputIt >
+void ponomarev::Heap< T, Compare, D >::heapify(InputIt first, InputIt last)
+{
+  clear();
+  while (first != last)
+  {
+    if (size_ == capacity_)
+    {
+      reserve(capacity_ == 0 ? D : capacity_ * 2);
+    }
+    new (data_ + size_) T(*first);
+    ++size_;
+    ++first;
+  }
+  for (size_t i = size_ / D + 1; i > 0; i--)
+  {
+    if (i - 1 < size_)
+    {
+      siftDown(i - 1);
+    }
+  }
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::clear() noexcept
+{
+  for (size_t i = 0; i < size_; i++)
+  {
+    data_[i].~T();
+  }
+  size_ = 0;
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::swap(Heap & other) noexcept
+{
+  std::swap(data_, other.data_);
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(comp_, other.comp_);
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::siftUp(size_t pos)
+{
+  T value = std::move(data_[pos]);
+  while (pos > 0)
+  {
+    size_t parent = (pos - 1) / D;
+    if (!comp_(data_[parent], value))
+    {
+      break;
+    }
+    data_[pos] = std::move(data_[parent]);
+    pos = parent;
+  }
+  data_[pos] = std::move(value);
+}
+
+template < typename T, typename Compare, size_t D >
+void ponomarev::Heap< T, Compare, D >::siftDown(size_t pos)
+{
+  T value = std::move(data_[pos]);
+  while (true)
+  {
+    size_t first = pos * D + 1;
+    if (first >= size_)
+    {
+      break;
+    }
+    size_t last = std::min(first + D, size_);
+    size_t best = first;
+    for (size_t i = first + 1; i < last; i++)
+    {
+      if (comp_(data_[best], data_[i]))
+      {
+        best = i;
+      }
+    }
+    if (!comp_(value, data_[best]))
+    {
+      break;
+    }
+    data_[pos] = std::move(data_[best]);
+    pos = best;
+  }
+  data_[pos] = std::move(value);
+}
+
+#endif
@@ -0,0 +1,259 @@
+#include "fonoTable.hpp"
+#include <ostream>
+
+namespace
+{
+  const unsigned char SOFTENS = 1;
+  const unsigned char IOTATED = 2;
+  const unsigned char ALWAYS_SOFT = 4;
+  const unsigned char ALWAYS_HARD = 8;
+  const unsigned char STRESSED = 16;
+
+  using psarev::SoundKind;
+
+  const psarev::LetterInfo letters[] = {
+    { U'а', SoundKind::Vowel, 0, 0 },
+    { U'б', SoundKind::VoicedPair, 0, U'п' },
+    { U'в', SoundKind::VoicedPair, 0, U'ф' },
+    { U'г', SoundKind::VoicedPair, 0, U'к' },
+    { U'д', SoundKind::VoicedPair, 0, U'т' },
+    { U'э', SoundKind::Vowel, SOFTENS | IOTATED, 0 },
+    { U'ж', SoundKind::VoicedPair, ALWAYS_HARD, U'ш' },
+    { U'з', SoundKind::VoicedPair, 0, U'с' },
+    { U'и', SoundKind::Vowel, SOFTENS, 0 },
+    { U'й', SoundKind::VoicedNPair, ALWAYS_SOFT, 0 },
+    { U'к', SoundKind::DeafPair, 0, U'г' },
+    { U'л', SoundKind::VoicedNPair, 0, 0 },
+    { U'м', SoundKind::VoicedNPair, 0, 0 },
+    { U'н', SoundKind::VoicedNPair, 0, 0 },
+    { U'о', SoundKind::Vowel, 0, 0 },
+    { U'п', SoundKind::DeafPair, 0, U'б' },
+    { U'р', SoundKind::VoicedNPair, 0, 0 },
+    { U'с', SoundKind::DeafPair, 0, U'з' },
+    { U'т', SoundKind::DeafPair, 0, U'д' },
+    { U'у', SoundKind::Vowel, 0, 0 },
+    { U'ф', SoundKind::DeafPair, 0, U'в' },
+    { U'х', SoundKind::DeafNPair, 0, 0 },
+    { U'ц', SoundKind::DeafNPair, ALWAYS_HARD, 0 },
+    { U'ч', SoundKind::DeafNPair, ALWAYS_SOFT, 0 },
+    { U'ш', SoundKind::DeafPair, ALWAYS_HARD, U'ж' },
+    { U'щ', SoundKind::DeafNPair, ALWAYS_SOFT, 0 },
+    { 0, SoundKind::Sign, 0, 0 },
+    { U'ы', SoundKind::Vowel, 0, 0 },
+    { 0, SoundKind::Sign, SOFTENS, 0 },
+    { U'э', SoundKind::Vowel, 0, 0 },
+    { U'у', SoundKind::Vowel, SOFTENS | IOTATED, 0 },
+    { U'а', SoundKind::Vowel, SOFTENS | IOTATED, 0 },
+    { U'о', SoundKind::Vowel, SOFTENS | IOTATED | STRESSED, 0 }
+  };
+
+  const char* const kindNames[] = {
+    "гласный",
+    "согласный, глухой непарный",
+    "согласный, глухой парный",
+    "согласный, звонкий непарный",
+    "согласный, звонкий парный",
+    ""
+  };
+
+  bool isConsonant(const psarev::LetterInfo* info)
+  {
+    return info->kind != SoundKind::Vowel && info->kind != SoundKind::Sign;
+  }
+
+  bool isDeaf(const psarev::LetterInfo* info)
+  {
+    return info->kind == SoundKind::DeafPair || info->kind == SoundKind::DeafNPair;
+  }
+}
+
+size_t psarev::decodeUtf8(const char* text, size_t length, size_t pos, char32_t& code)
+{
+  unsigned char lead = static_cast< unsigned char >(text[pos]);
+  size_t extra = 0;
+  if (lead < 0x80)
+  {
+    code = lead;
+  }
+  else if ((lead & 0xE0) == 0xC0)
+  {
+    code = lead & 0x1F;
+    extra = 1;
+  }
+  else if ((lead & 0xF0) == 0xE0)
+  {
+    code = lead & 0x0F;
+    extra = 2;
+  }
+  else if ((lead & 0xF8) == 0xF0)
+  {
+    code = lead & 0x07;
+    extra = 3;
+  }
+  else
+  {
+    code = 0xFFFD;
+    return pos + 1;
+  }
+  if (pos + extra >= length)
+  {
+    code = 0xFFFD;
+    return length;
+  }
+  for (size_t i = 1; i <= extra; i++)
+  {
+    unsigned char next = static_cast< unsigned char >(text[pos + i]);
+    if ((next & 0xC0) != 0x80)
+    {
+      code = 0xFFFD;
+      return pos + i;
+    }
+    code = (code << 6) | (next & 0x3F);
+  }
+  return pos + extra + 1;
+}
+
+void psarev::appendUtf8(std::string& dest, char32_t code)
+{
+  if (code < 0x80)
+  {
+    dest += static_cast< char >(code);
+  }
+  else if (code < 0x800)
+  {
+    dest += static_cast< char >(0xC0 | (code >> 6));
+    dest += static_cast< char >(0x80 | (code & 0x3F));
+  }
+  else if (code < 0x10000)
+  {
+    dest += static_cast< char >(0xE0 | (code >> 12));
+    dest += static_cast< char >(0x80 | ((code >> 6) & 0x3F));
+    dest += static_cast< char >(0x80 | (code & 0x3F));
+  }
+  else
+  {
+    dest += static_cast< char >(0xF0 | (code >> 18));
+    dest += static_cast< char >(0x80 | ((code >> 12) & 0x3F));
+    dest += static_cast< char >(0x80 | ((code >> 6) & 0x3F));
+    dest += static_cast< char >(0x80 | (code & 0x3F));
+  }
+}
+
+const psarev::LetterInfo* psarev::findLetter(char32_t code)
+{
+  if (code >= U'А' && code <= U'Я')
+  {
+    code += U'а' - U'А';
+  }
+  else if (code == U'Ё')
+  {
+    code = U'ё';
+  }
+  if (code >= U'а' && code <= U'я')
+  {
+    return &letters[code - U'а'];
+  }
+  if (code == U'ё')
+  {
+    return &letters[U'я' - U'а' + 1];
+  }
+  return nullptr;
+}
+
+void psarev::transcribe(const char* word, size_t length, sounds_t& sounds)
+{
+  sounds.clear();
+  const LetterInfo* prev = nullptr;
+  size_t pos = 0;
+  char32_t code = 0;
+  const LetterInfo* cur = nullptr;
+  while (pos < length && cur == nullptr)
+  {
+    pos = decodeUtf8(word, length, pos, code);
+    cur = findLetter(code);
+  }
+  while (cur != nullptr)
+  {
+    const LetterInfo* next = nullptr;
+    while (pos < length && next == nullptr)
+    {
+      pos = decodeUtf8(word, length, pos, code);
+      next = findLetter(code);
+    }
+
+    if (cur->kind == SoundKind::Vowel)
+    {
+      if ((cur->flags & IOTATED) && (prev == nullptr || !isConsonant(prev)))
+      {
+        sounds.push_back({ findLetter(U'й'), true, false });
+      }
+      sounds.push_back({ cur, false, (cur->flags & STRESSED) != 0 });
+    }
+    else if (cur->kind != SoundKind::Sign)
+    {
+      bool soft = (cur->flags & ALWAYS_SOFT) || (!(cur->flags & ALWAYS_HARD) && next && (next->flags & SOFTENS));
+      sounds.push_back({ cur, soft, false });
+    }
+    prev = cur;
+    cur = next;
+  }
+
+  for (size_t i = sounds.size(); i > 0; i--)
+  {
+    Sound& sound = sounds[i - 1];
+    if (sound.info->kind != SoundKind::VoicedPair)
+    {
+      continue;
+    }
+    if (i == sounds.size() || (isConsonant(sounds[i].info) && isDeaf(sounds[i].info)))
+    {
+      sound.info = findLetter(sound.info->pair);
+    }
+  }
+}
+
+void psarev::appendTranscription(std::string& dest, const sounds_t& sounds)
+{
+  dest += '[';
+  for (const Sound& sound : sounds)
+  {
+    appendUtf8(dest, sound.info->sound);
+    if (sound.soft && sound.info->sound != U'й')
+    {
+      dest += '\'';
+    }
+  }
+  dest += ']';
+}
+
+std::ostream& psarev::printSound(std::ostream& out, const Sound& sound)
+{
+  std::string letter;
+  appendUtf8(letter, sound.info->sound);
+  out << "[ " << letter << " ] - " << kindNames[static_cast< size_t >(sound.info->kind)];
+  if (sound.info->kind == SoundKind::Vowel)
+  {
+    if (sound.stressed)
+    {
+      out << " ,ударный";
+    }
+  }
+  else if (sound.info->flags & ALWAYS_SOFT)
+  {
+    out << " ,мягкий непарный";
+  }
+  else if (sound.info->flags & ALWAYS_HARD)
+  {
+    out << " ,твердый непарный";
+  }
+  else if (sound.soft)
+  {
+    out << " ,мягкий парный";
+  }
+  else
+  {
+    out << " ,твердый парный";
+  }
+  out << '\n';
+  return out;
+}
@@ -0,0 +1,45 @@
+#ifndef FONO_TABLE_HPP
+#define FONO_TABLE_HPP
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace psarev
+{
+  enum class SoundKind : unsigned char
+  {
+    Vowel,
+    DeafNPair,
+    DeafPair,
+    VoicedNPair,
+    VoicedPair,
+    Sign
+  };
+
+  struct LetterInfo
+  {
+    char32_t sound;
+    SoundKind kind;
+    unsigned char flags;
+    char32_t pair;
+  };
+
+  struct Sound
+  {
+    const LetterInfo* info;
+    bool soft;
+    bool stressed;
+  };
+
+  using sounds_t = std::vector< Sound >;
+
+  size_t decodeUtf8(const char* text, size_t length, size_t pos, char32_t& code);
+  void appendUtf8(std::string& dest, char32_t code);
+  const LetterInfo* findLetter(char32_t code);
+
+  void transcribe(const char* word, size_t length, sounds_t& sounds);
+  void appendTranscription(std::string& dest, const sounds_t& sounds);
+  std::ostream& printSound(std::ostream& out, const Sound& sound);
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include "internalFuncs.hpp"
 #include <cctype>
+#include <iterator>
 
 std::ostream& psarev::outInvCommand(std::ostream& out)
 {
@@ -55,33 +56,44 @@ std::ostream& psarev::outTypesAmount(std::ostream& out, const std::string type,
   return out;
 }
 
-using storage_t = psarev::avlTree< std::string, psarev::List< std::string > >;
+std::ostream& psarev::outFonoStats(std::ostream& out, size_t words, double seconds)
+{
+  out << "Transcribed " << words << " words in " << seconds << " s";
+  if (seconds > 0)
+  {
+    out << " (" << static_cast< size_t >(words / seconds) << " words/sec)";
+  }
+  out << '\n';
+  return out;
+}
 
-psarev::avlTree< std::string, psarev::List< std::string > > psarev::readStorage(std::istream& in)
+psarev::storage_t psarev::readStorage(std::istream& in)
 {
+  std::string text((std::istreambuf_iterator< char >(in)), std::istreambuf_iterator< char >());
   storage_t resStorage;
   std::string word = "";
 
-  while (!in.eof())
+  size_t pos = 0;
+  while (pos < text.size())
   {
-    if (in >> word)
+    while (pos < text.size() && std::isspace(static_cast< unsigned char >(text[pos])))
     {
-      cleanUpWord(word);
-      if (checkLiter(word))
-      {
-        std::string spType = getSpType(word);
-        auto scanFor = resStorage.find(spType);
-        if (scanFor == resStorage.end())
-        {
-          List< std::string > words;
-          words.pushBack(word);
-          resStorage.insert({ spType, words });
-        }
-        else
-        {
-          (resStorage.at(spType)).pushBack(word);
-        }
-      }
+      ++pos;
+    }
+    size_t start = pos;
+    while (pos < text.size() && !std::isspace(static_cast< unsigned char >(text[pos])))
+    {
+      ++pos;
+    }
+    if (start == pos)
+    {
+      break;
+    }
+    word.assign(text, start, pos - start);
+    cleanUpWord(word);
+    if (!word.empty() && checkLiter(word))
+    {
+      resStorage[getSpType(word)].append(word);
     }
   }
   return resStorage;
@@ -92,7 +104,7 @@ void psarev::cleanUpWord(std::string& word)
   const std::string puncts = ".,:;?!";
   for (char p : puncts)
   {
-    if (word.back() == p)
+    if (!word.empty() && word.back() == p)
     {
       word.pop_back();
     }
@@ -101,11 +113,11 @@ void psarev::cleanUpWord(std::string& word)
   const std::string extras = "(){}[]<>'";
   for (char ex : extras)
   {
-    if (word.back() == ex)
+    if (!word.empty() && word.back() == ex)
     {
       word.pop_back();
     }
-    if (word.front() == ex)
+    if (!word.empty() && word.front() == ex)
     {
       word.erase(word.begin());
     }
@@ -116,7 +128,8 @@ bool psarev::checkLiter(const std::string& word)
 {
   for (char c : word)
   {
-    if (!isalpha(c))
+    unsigned char symb = static_cast< unsigned char >(c);
+    if (symb < 0x80 && !std::isalpha(symb))
     {
       return false;
     }
@@ -124,62 +137,79 @@ bool psarev::checkLiter(const std::string& word)
   return true;
 }
 
-std::string psarev::getSpType(std::string& word)
+namespace
 {
-  std::string resType = "";
-  storage_t rusEnds;
+  void appendEnds(psarev::List< std::string >& dest, const psarev::List< std::string >& src)
+  {
+    for (auto iter = src.begin(); iter != src.end(); ++iter)
+    {
+      dest.pushBack(*iter);
+    }
+  }
+}
+
+psarev::ends_t psarev::makeRusEnds()
+{
+  ends_t rusEnds;
 
   rusEnds["noun"] = { "а", "ев", "ов", "ье", "иями", "ями", "ами", "еи", "ии", "и", "ией" };
   List< std::string > nSec = { "ем", "ам", "ом", "о", "у", "ах", "иях", "ях" };
   List< std::string > nThi = { "я", "ок", "мва", "яна", "ровать", "ег", "ги" };
   List< std::string > nFou = { "ий", "й", "иям", "ю", "ия", "ья", "ям", "ием" };
   List< std::string > nFif = { "ы", "ь", "ию", "ью", "га", "сть", "сти", "ей", "ой" };
-  rusEnds["noun"].insert(rusEnds["noun"].end(), nSec.begin(), nSec.end());
-  rusEnds["noun"].insert(rusEnds["noun"].end(), nThi.begin(), nThi.end());
-  rusEnds["noun"].insert(rusEnds["noun"].end(), nFou.begin(), nFou.end());
-  rusEnds["noun"].insert(rusEnds["noun"].end(), nFif.begin(), nFif.end());
+  appendEnds(rusEnds["noun"], nSec);
+  appendEnds(rusEnds["noun"], nThi);
+  appendEnds(rusEnds["noun"], nFou);
+  appendEnds(rusEnds["noun"], nFif);
 
   rusEnds["verb"] = { "ила", "ыла", "ена", "ейте", "уйте", "ите", "или", "ыли", "ей", "уй" };
   List< std::string > vSec = { "ено", "ят", "ует", "уют", "ит", "ыт", "ены", "ить" };
   List< std::string > vThi = { "на", "ете", "йте", "ли", "й", "л", "ем", "н", "ло" };
   List< std::string > vFou = { "им", "ым", "ен", "ило", "ыло", "ть", "ешь", "нно", "ет" };
   List< std::string > vFif = { "ыть", "ишь", "ую", "ют", "ны", "ю", "ла", "ил", "ыл" };
-  rusEnds["verb"].insert(rusEnds["verb"].end(), vSec.begin(), vSec.end());
-  rusEnds["verb"].insert(rusEnds["verb"].end(), vThi.begin(), vThi.end());
-  rusEnds["verb"].insert(rusEnds["verb"].end(), vFou.begin(), vFou.end());
-  rusEnds["verb"].insert(rusEnds["verb"].end(), vFif.begin(), vFif.end());
+  appendEnds(rusEnds["verb"], vSec);
+  appendEnds(rusEnds["verb"], vThi);
+  appendEnds(rusEnds["verb"], vFou);
+  appendEnds(rusEnds["verb"], vFif);
 
   rusEnds["adjective"] = { "ее", "ие", "ые", "ое", "ими", "ыми", "ей", "ий", "ый", "ой" };
   List< std::string > aSec = { "его", "ого", "ему", "ому", "их", "ых", "ую", "юю" };
   List< std::string > aThi = { "ая", "яя", "ою", "ею", "ем", "им", "ым", "ом" };
-  rusEnds["adjective"].insert(rusEnds["adjective"].end(), aSec.begin(), aSec.end());
-  rusEnds["adjective"].insert(rusEnds["adjective"].end(), aThi.begin(), aThi.end());
+  appendEnds(rusEnds["adjective"], aSec);
+  appendEnds(rusEnds["adjective"], aThi);
 
   rusEnds["adverb"] = { "чно", "еко", "око", "имо", "мно", "жно", "жко", "ело", "тно" };
   List< std::string > dSec = { "здо", "зко", "шо", "хо", "но", "льно" };
-  rusEnds["adjective"].insert(rusEnds["adjective"].end(), dSec.begin(), dSec.end());
+  appendEnds(rusEnds["adjective"], dSec);
 
   rusEnds["numeric"] = { "много", "еро", "вое", "рое", "еро", "сти", "двух", "рех", "еми" };
   List< std::string > uSec = { "дного", "сот", "сто", "ста", "тысяча", "тысячи" };
   List< std::string > uThi = { "мью", "тью", "одним", "умя", "тью", "мя", "тью" };
   List< std::string > uFou = { "три", "одна", "яти", "ьми", "ати", "две" };
-  rusEnds["numeric"].insert(rusEnds["numeric"].end(), uSec.begin(), uSec.end());
-  rusEnds["numeric"].insert(rusEnds["numeric"].end(), uThi.begin(), uThi.end());
-  rusEnds["numeric"].insert(rusEnds["numeric"].end(), uFou.begin(), uFou.end());
+  appendEnds(rusEnds["numeric"], uSec);
+  appendEnds(rusEnds["numeric"], uThi);
+  appendEnds(rusEnds["numeric"], uFou);
 
   rusEnds["conjuct"] = { "более", "менее", "очень", "крайне", "когда", "однако", "если" };
   List< std::string > cSec = { "зато", "что", "или", "потом", "это", "того", "тоже" };
   List< std::string > cThi = { "и", "да", "кабы", "коли", "ничем", "чем", "также" };
   List< std::string > cFou = { "словно", "ежели", "хотя", "как", "так", "чтоб" };
-  rusEnds["conjuct"].insert(rusEnds["conjuct"].end(), cSec.begin(), cSec.end());
-  rusEnds["conjuct"].insert(rusEnds["conjuct"].end(), cThi.begin(), cThi.end());
-  rusEnds["conjuct"].insert(rusEnds["conjuct"].end(), cFou.begin(), cFou.end());
+  appendEnds(rusEnds["conjuct"], cSec);
+  appendEnds(rusEnds["conjuct"], cThi);
+  appendEnds(rusEnds["conjuct"], cFou);
 
   rusEnds["prepos"] = { "в", "на", "slovo", "из", "за", "у", "от", "с", "об", "к", "перед" };
   List< std::string > pSec = { "из-под", "для", "про", "до", "о", "вокруг", "при" };
   List< std::string > pThi = { "возле", "из-за", "без", "между", "под", "около" };
-  rusEnds["prepos"].insert(rusEnds["prepos"].end(), pSec.begin(), pSec.end());
-  rusEnds["prepos"].insert(rusEnds["prepos"].end(), pThi.begin(), pThi.end());
+  appendEnds(rusEnds["prepos"], pSec);
+  appendEnds(rusEnds["prepos"], pThi);
+  return rusEnds;
+}
+
+std::string psarev::getSpType(std::string& word)
+{
+  std::string resType = "";
+  static ends_t rusEnds = makeRusEnds();
 
   for (auto iter = rusEnds["prepos"].cbegin(); iter != rusEnds["prepos"].cend(); ++iter)
   {
@@ -220,6 +250,10 @@ std::string psarev::getSpType(std::string& word)
 
 bool psarev::checkType(std::string& word, size_t& endSize, List< std::string >& ends)
 {
+  if (endSize > word.length())
+  {
+    return false;
+  }
   std::string endL = word.substr(word.length() - endSize);
   for (auto iter = ends.begin(); iter != ends.end(); ++iter)
   {
@@ -233,177 +267,20 @@ bool psarev::checkType(std::string& word, size_t& endSize, List< std::string >&
 
 void psarev::outDepot(std::string dest, std::ofstream& out, avlTree< std::string, storage_t >& depot)
 {
-  for (auto storage : depot)
+  for (auto storage = depot.begin(); storage != depot.end(); ++storage)
   {
-    out.open(dest + "\\" + storage.first + ".txt");
+    out.open(dest + "\\" + storage->first + ".txt");
     if (out.is_open())
     {
-      for (auto iter : storage.second)
+      for (auto iter = storage->second.begin(); iter != storage->second.end(); ++iter)
       {
-        size_t len = (iter.second).getSize();
+        size_t len = (iter->second).getSize();
         for (size_t i = 0; i < len; i++)
         {
-          out << iter.second[i] << " ";
+          (iter->second).print(out, i) << " ";
         }
       }
     }
     out.close();
   }
 }
-
-int psarev::letToSound(int let, bool& softFact)
-{
-  const std::string softMakers = "ёйеячищюь";
-  const std::string notSoftMakers = "цукнгшзхъфывапролджэсмтб";
-
-  avlTree< int, int > softSounds = { { -11887, -12098 }, { -12103, -12103 }, { -11889, -12112 }, { -11897, -11897 },
-  { -12104, -12104 }, { -11895, -11895 }, { -11890, -11901 } };
-
-  for (int l : softMakers)
-  {
-    if (l == let)
-    {
-      softFact = true;
-      return (*(softSounds.find(l))).second;
-    }
-  }
-
-  avlTree< int, int > nSoftSounds = { { -11898, -11898 }, { -11901, -11901 }, { -12102, -12102 }, { -12099, -12099 },
-  { -12109, -12102 }, { -11896, -11896 }, { -12105, -11903 }, { -11899, -11899 }, { -11900, -11900 },
-  { -11893, -11893 }, { -12110, -12110 }, { -12112, -12112 }, { -12097, -12097 }, { -11904, -11904 },
-  { -12098, -12098 }, { -12101, -12101 }, { -12108, -11902 }, { -12106, -11896 }, { -11891, -11891 },
-  { -11903, -11903 }, { -12100, -12100 }, { -11902, -11902 }, { -12111, -12097 } };
-
-  for (int l : notSoftMakers)
-  {
-    if (l == let)
-    {
-      softFact = false;
-      return (*(nSoftSounds.find(l))).second;
-    }
-  }
-  return ' ';
-}
-
-bool psarev::printSound(std::ostream& out, int sound, bool softFact)
-{
-  const std::string vowel = "уыаоэи";
-  for (int l : vowel)
-  {
-    if (l == sound)
-    {
-      out << "[ " << sound << " ] - гласный";
-      if (l == -12098 && softFact)
-      {
-        out << " ,ударный";
-      }
-      out << '\n';
-      return true;
-    }
-  }
-
-  const std::string deafNPair = "хцчщ";
-  const std::string deafPair = "кшфпст";
-  const std::string voicedNPair = "йнрмл";
-  const std::string voicedPair = "гзвдж";
-  for (int l : deafNPair)
-  {
-    if (l == sound)
-    {
-      out << "[ " << sound << " ] - согласный, глухой непарный";
-      if ((softFact && l == -11899) || (l != -11899))
-      {
-        out << " ,мягкий";
-        if (l == -11899)
-        {
-          out << " парный";
-        }
-        else
-        {
-          out << " непарный";
-        }
-      }
-      else if (!softFact && l == -11899)
-      {
-        out << " ,твердый парный";
-      }
-      out << '\n';
-      return false;
-    }
-  }
-
-  for (int l : deafPair)
-  {
-    if (l == sound)
-    {
-      out << "[ " << sound << " ] - согласный, глухой парный";
-      if (softFact && l != -11896)
-      {
-        out << " ,мягкий";
-        if (l == -11896)
-        {
-          out << " непарный";
-        }
-        else
-        {
-          out << " парный";
-        }
-      }
-      else
-      {
-        if (l == -11896)
-        {
-          out << " ,твердый непарный";
-        }
-        else
-        {
-          out << " ,твердый парный";
-        }
-      }
-      out << '\n';
-      return false;
-    }
-  }
-
-  for (int l : voicedNPair)
-  {
-    if (l == sound)
-    {
-      out << "[ " << sound << " ] - согласный, звонкий непарный";
-      if (l == -12103)
-      {
-        out << " ,мягкий непарный";
-      }
-      else if (softFact)
-      {
-        out << " ,мягкий парный";
-      }
-      else
-      {
-        out << " ,твердый парный";
-      }
-      out << '\n';
-      return false;
-    }
-  }
-
-  for (int l : voicedPair)
-  {
-    if (l == sound)
-    {
-      out << "[ " << sound << " ] - согласный, звонкий парный";
-      if (softFact)
-      {
-        out << " ,мягкий парный";
-      }
-      else
-      {
-        out << " ,твердый парный";
-      }
-      out << '\n';
-      return false;
-    }
-  }
-
-  return false;
-}
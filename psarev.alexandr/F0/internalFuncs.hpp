@@ -5,10 +5,12 @@
 #include <string>
 #include <list.hpp>
 #include <avlTree.hpp>
+#include "wordArena.hpp"
 
 namespace psarev
 {
-  using storage_t = avlTree< std::string, List< std::string > >;
+  using storage_t = avlTree< std::string, WordArena >;
+  using ends_t = avlTree< std::string, List< std::string > >;
 
   std::ostream& outInvCommand(std::ostream& out);
   std::ostream& outEmptyFile(std::ostream& out);
@@ -21,6 +23,7 @@ namespace psarev
   std::ostream& outDirectWrite(std::ostream& out);
   std::ostream& outAdmMessage(std::ostream& out);
   std::ostream& outTypesAmount(std::ostream& out, const std::string type, size_t amo);
+  std::ostream& outFonoStats(std::ostream& out, size_t words, double seconds);
 
   storage_t readStorage(std::istream& in);
 
@@ -29,11 +32,9 @@ namespace psarev
 
   std::string getSpType(std::string& word);
   bool checkType(std::string& word, size_t& endSize, List< std::string >& ends);
+  ends_t makeRusEnds();
 
   void outDepot(std::string dest, std::ofstream& out, avlTree< std::string, storage_t >& depot);
-
-  int letToSound(int let, bool& softFact);
-  bool printSound(std::ostream& out, int sound, bool softFact);
 }
 
 #endif
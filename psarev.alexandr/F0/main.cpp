@@ -3,7 +3,7 @@
 
 int main()
 {
-  using storage_t = psarev::avlTree< std::string, psarev::List< std::string > >;
+  using storage_t = psarev::storage_t;
   psarev::avlTree< std::string, storage_t > depot;
   std::string defaultSt = "";
 
@@ -16,12 +16,13 @@ int main()
     userCmds.insert({"list", std::bind(psarev::cmdList, _2, _3) });
     userCmds.insert({"show", psarev::cmdShow });
     userCmds.insert({"rename", psarev::cmdRename });
-    userCmds.insert({"choose", std::bind(psarev::cmdCreate, _1, _2, _3, defaultSt) });
+    userCmds.insert({"choose", std::bind(psarev::cmdChoose, _1, _2, _3, std::ref(defaultSt)) });
     userCmds.insert({"save", psarev::cmdSave });
 
-    userCmds.insert({"print", std::bind(psarev::cmdPrint, _1, _2, _3, defaultSt) });
+    userCmds.insert({"print", std::bind(psarev::cmdPrint, _1, _2, _3, std::ref(defaultSt)) });
     userCmds.insert({"fono", std::bind(psarev::cmdFono, _1, _2) });
-    userCmds.insert({"makeSent", std::bind(psarev::cmdMakeSent, _1, _2, _3, defaultSt) });
+    userCmds.insert({"fonoAll", std::bind(psarev::cmdFonoAll, _2, _3, std::ref(defaultSt)) });
+    userCmds.insert({"makeSent", std::bind(psarev::cmdMakeSent, _1, _2, _3, std::ref(defaultSt)) });
   }
 
   std::string userCmd = "";
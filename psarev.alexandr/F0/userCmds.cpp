@@ -1,4 +1,5 @@
 #include "userCmds.hpp"
+#include <chrono>
 #include <stdexcept>
 
 void psarev::cmdHelp(std::istream& in, std::ostream& out)
@@ -16,12 +17,11 @@ void psarev::cmdHelp(std::istream& in, std::ostream& out)
   out << "7. choose < name > - Selecting the < name > storage for further interaction with its elements.\n";
   out << "7.1 print < speechType > - Displaying a list of all words of the specified < speechType > from the choosed storage.\n";
   out << "7.2 fono < word > - Performing phonetic analisys of the word < word > and displaying the result on the screen.\n";
+  out << "7.2.1 fonoAll - Transcribing every word of the choosed storage and displaying the transcription speed.\n";
   out << "7.3 makeSent < num > - Making a sentence from < num > words in the choosed storage, if it possible.\n";
   out << "7.4 save < dest > - Saving whole depot to the < dest > directory.\n";
 }
 
-using storage_t = psarev::avlTree< std::string, psarev::List< std::string > >;
-
 void psarev::cmdCreate(std::istream& in, std::ostream& out, psarev::avlTree< std::string, storage_t >& depot, std::string dest)
 {
   std::string file;
@@ -41,11 +41,10 @@ void psarev::cmdCreate(std::istream& in, std::ostream& out, psarev::avlTree< std
       if (!in)
       {
         psarev::outInvCommand(out);
+        return;
       }
-      depot.insert({ name, storage_t() });
-      storage_t tempoStorage = depot[name];
-      storage_t newStorage = psarev::readStorage(fileIn);
-      tempoStorage = newStorage;
+      depot.erase(name);
+      depot.insert({ name, psarev::readStorage(fileIn) });
       psarev::outSucCreate(out, name);
     }
   }
@@ -104,9 +103,15 @@ void psarev::cmdShow(std::istream& in, std::ostream& out, avlTree< std::string,
   std::string tempoS;
   in >> tempoS;
 
+  auto shStorage = depot.find(tempoS);
+  if (shStorage == depot.end())
+  {
+    psarev::outInvCommand(out);
+    return;
+  }
   psarev::outStoreName(out, tempoS);
 
-  for (auto iter = depot[tempoS].begin(); iter != depot[tempoS].end(); ++iter)
+  for (auto iter = shStorage->second.begin(); iter != shStorage->second.end(); ++iter)
   {
     psarev::outTypesAmount(out, (*iter).first, ((*iter).second).getSize());
   }
@@ -177,18 +182,20 @@ void psarev::cmdPrint(std::istream& in, std::ostream& out, avlTree<std::string,
     return;
   }
   auto chStorage = depot.find(storage);
-  storage_t curStorage = (*chStorage).second;
-  for (auto iter = curStorage.begin(); iter != curStorage.end(); iter++)
+  if (chStorage == depot.end())
   {
-    if ((*iter).first == speechType)
+    psarev::outInvCommand(out);
+    return;
+  }
+  auto words = chStorage->second.find(speechType);
+  if (words != chStorage->second.end())
+  {
+    out << words->first << ": \n";
+    for (size_t i = 0; i < words->second.getSize(); i++)
     {
-      out << (*iter).first << ": \n";
-      for (size_t i = 0; i < (*iter).second.getSize(); i++)
-      {
-        out << (*iter).second[i] << " ";
-      }
-      out << "\n";
+      words->second.print(out, i) << " ";
     }
+    out << "\n";
   }
 }
 
@@ -201,53 +208,53 @@ void psarev::cmdFono(std::istream& in, std::ostream& out)
     return;
   }
 
-  List< std::string > soundsVec;
-  bool softFact = false;
-  const std::string vowels = "ёуеыаоэяию";
-  const std::string cons = "йцкнгшщзхфвпрлджчсмтб";
-  const std::string other = "ъь";
-  std::string transc = "[]";
-  for (int let : word)
+  sounds_t sounds;
+  transcribe(word.data(), word.size(), sounds);
+  std::string transc;
+  appendTranscription(transc, sounds);
+  out << transc << '\n';
+  for (const Sound& sound : sounds)
   {
-    for (int l : vowels)
-    {
-      if (let == l)
-      {
-        transc += letToSound(let, softFact);
-      }
-    }
-    for (int l : cons)
-    {
-      if (let == l)
-      {
-        transc += letToSound(let, softFact);
-      }
-      if (l == -11887 || l == -12107 || l == -11889 || l == -12104 || l == -11890)
-      {
-        softFact = true;
-      }
-      else
-      {
-        softFact = false;
-      }
-    }
-    for (int l : other)
-    {
-      if (l == -11892)
-      {
-        softFact = true;
-      }
-    }
+    printSound(out, sound);
   }
+}
 
-  softFact = false;
-  for (int s : transc)
+void psarev::cmdFonoAll(std::ostream& out, avlTree< std::string, storage_t >& depot, std::string& storage)
+{
+  auto chStorage = depot.find(storage);
+  if (chStorage == depot.end())
   {
-    if (s != '[' && s != ']')
+    psarev::outInvCommand(out);
+    return;
+  }
+
+  const size_t blockSize = 1 << 16;
+  std::string buffer;
+  buffer.reserve(blockSize + blockSize / 4);
+  sounds_t sounds;
+  size_t words = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (auto iter = chStorage->second.begin(); iter != chStorage->second.end(); ++iter)
+  {
+    const WordArena& arena = iter->second;
+    for (size_t i = 0; i < arena.getSize(); i++)
     {
-      softFact = printSound(out, s, softFact);
+      transcribe(arena.getWord(i), arena.getLength(i), sounds);
+      buffer.append(arena.getWord(i), arena.getLength(i));
+      buffer += ' ';
+      appendTranscription(buffer, sounds);
+      buffer += '\n';
+      if (buffer.size() >= blockSize)
+      {
+        out.write(buffer.data(), static_cast< std::streamsize >(buffer.size()));
+        buffer.clear();
+      }
+      words++;
     }
   }
+  out.write(buffer.data(), static_cast< std::streamsize >(buffer.size()));
+  std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+  psarev::outFonoStats(out, words, elapsed.count());
 }
 
 void psarev::cmdMakeSent(std::istream& in, std::ostream& out, avlTree<std::string, storage_t>& depot, std::string& storage)
@@ -260,15 +267,19 @@ void psarev::cmdMakeSent(std::istream& in, std::ostream& out, avlTree<std::strin
   }
 
   auto chStorage = depot.find(storage);
-  storage_t curStorage = (*chStorage).second;
-  for (auto iter = curStorage.begin(); iter != curStorage.end(); iter++)
+  if (chStorage == depot.end())
+  {
+    psarev::outInvCommand(out);
+    return;
+  }
+  for (auto iter = chStorage->second.begin(); iter != chStorage->second.end(); iter++)
   {
     size_t curNum = 0;
     for (size_t i = 0; i < (*iter).second.getSize(); i++)
     {
       if (curNum <= usNum)
       {
-        out << (*iter).second[i] << " ";
+        (*iter).second.print(out, i) << " ";
         curNum++;
       }
       else
@@ -1,11 +1,10 @@
 #ifndef USER_CMDS_HPP
 #define USER_CMDS_HPP
 #include "internalFuncs.hpp"
+#include "fonoTable.hpp"
 
 namespace psarev
 {
-  using storage_t = avlTree< std::string, List< std::string > >;
-
   void cmdHelp(std::istream& in, std::ostream& out);
   void cmdCreate(std::istream& in, std::ostream& out, avlTree< std::string, storage_t >& depot, std::string dest);
   void cmdDelete(std::istream& in, std::ostream& out, avlTree< std::string, storage_t >& depot);
@@ -17,6 +16,7 @@ namespace psarev
 
   void cmdPrint(std::istream& in, std::ostream& out, avlTree< std::string, storage_t >& depot, std::string& storage);
   void cmdFono(std::istream& in, std::ostream& out);
+  void cmdFonoAll(std::ostream& out, avlTree< std::string, storage_t >& depot, std::string& storage);
   void cmdMakeSent(std::istream& in, std::ostream& out, avlTree< std::string, storage_t >& depot, std::string& storage);
 }
 
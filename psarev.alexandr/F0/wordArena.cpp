@@ -0,0 +1,38 @@
+#include "wordArena.hpp"
+#include <ostream>
+
+psarev::WordArena::WordArena() :
+  chars(),
+  offsets(1, 0)
+{}
+
+void psarev::WordArena::append(const std::string& word)
+{
+  append(word.data(), word.size());
+}
+
+void psarev::WordArena::append(const char* word, size_t length)
+{
+  chars.append(word, length);
+  offsets.push_back(chars.size());
+}
+
+size_t psarev::WordArena::getSize() const noexcept
+{
+  return offsets.size() - 1;
+}
+
+const char* psarev::WordArena::getWord(size_t index) const
+{
+  return chars.data() + offsets[index];
+}
+
+size_t psarev::WordArena::getLength(size_t index) const
+{
+  return offsets[index + 1] - offsets[index];
+}
+
+std::ostream& psarev::WordArena::print(std::ostream& out, size_t index) const
+{
+  return out.write(chars.data() + offsets[index], static_cast< std::streamsize >(getLength(index)));
+}
@@ -0,0 +1,28 @@
+#ifndef WORD_ARENA_HPP
+#define WORD_ARENA_HPP
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace psarev
+{
+  class WordArena
+  {
+  public:
+    WordArena();
+
+    void append(const std::string& word);
+    void append(const char* word, size_t length);
+
+    size_t getSize() const noexcept;
+    const char* getWord(size_t index) const;
+    size_t getLength(size_t index) const;
+    std::ostream& print(std::ostream& out, size_t index) const;
+
+  private:
+    std::string chars;
+    std::vector< size_t > offsets;
+  };
+}
+
+#endif
@@ -1,4 +1,64 @@
 #include "execCommands.hpp"
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace
+{
+  using entry_t = std::pair< int, std::string >;
+
+  const unsigned char ONLY_FIRST = 1;
+  const unsigned char IN_BOTH = 2;
+  const unsigned char ONLY_SECOND = 4;
+
+  psarev::base_t mergeSets(const psarev::base_t& fSet, const psarev::base_t& sSet, unsigned char parts)
+  {
+    const bool onlyF = parts & ONLY_FIRST;
+    const bool both = parts & IN_BOTH;
+    const bool onlyS = parts & ONLY_SECOND;
+    std::vector< entry_t > res;
+    res.reserve(fSet.getSize() + (onlyS ? sSet.getSize() : 0));
+    auto fIter = fSet.cbegin();
+    auto sIter = sSet.cbegin();
+    while (fIter != fSet.cend() && sIter != sSet.cend())
+    {
+      if (fIter->first < sIter->first)
+      {
+        if (onlyF)
+        {
+          res.push_back(*fIter);
+        }
+        ++fIter;
+      }
+      else if (sIter->first < fIter->first)
+      {
+        if (onlyS)
+        {
+          res.push_back(*sIter);
+        }
+        ++sIter;
+      }
+      else
+      {
+        if (both)
+        {
+          res.push_back(*fIter);
+        }
+        ++fIter;
+        ++sIter;
+      }
+    }
+    for (; onlyF && fIter != fSet.cend(); ++fIter)
+    {
+      res.push_back(*fIter);
+    }
+    for (; onlyS && sIter != sSet.cend(); ++sIter)
+    {
+      res.push_back(*sIter);
+    }
+    return psarev::base_t::fromSorted(std::make_move_iterator(res.begin()), std::make_move_iterator(res.end()));
+  }
+}
 
 std::ostream& psarev::outInvCommand(std::ostream& out)
 {
@@ -14,6 +74,7 @@ std::ostream& psarev::outEmpty(std::ostream& out)
 
 void psarev::fillTree(std::istream& in, avlTree< std::string, base_t >& dataSets)
 {
+  std::vector< entry_t > entries;
   while (!in.eof())
   {
     if (in.fail())
@@ -24,16 +85,34 @@ void psarev::fillTree(std::istream& in, avlTree< std::string, base_t >& dataSets
     std::string setName;
     int key;
     in >> setName;
-    psarev::avlTree< int, std::string > curSet;
+    entries.clear();
+    bool sorted = true;
 
     while (in >> key)
     {
       std::string value;
       in >> value;
-      curSet.insert({ key, value });
+      if (!entries.empty() && entries.back().first >= key)
+      {
+        sorted = false;
+      }
+      entries.emplace_back(key, std::move(value));
+    }
+
+    if (!sorted)
+    {
+      std::stable_sort(entries.begin(), entries.end(), [](const entry_t& lhs, const entry_t& rhs)
+        {
+          return lhs.first < rhs.first;
+        });
+      auto last = std::unique(entries.begin(), entries.end(), [](const entry_t& lhs, const entry_t& rhs)
+        {
+          return lhs.first == rhs.first;
+        });
+      entries.erase(last, entries.end());
     }
 
-    dataSets.insert({ setName, curSet });
+    dataSets.insert({ setName, base_t::fromSorted(entries.begin(), entries.end()) });
   }
 }
 
@@ -76,22 +155,14 @@ void psarev::complement(avlTree< std::string, avlTree< int, std::string > >& dat
     return;
   }
 
-  avlTree< int, std::string > resSet;
-  for (auto iter = (*fSetIter).second.begin(); iter != (*fSetIter).second.end(); iter++)
-  {
-    auto newIter = (*dataSets.find(sSet)).second.find((*iter).first);
-    if (newIter == (*dataSets.find(sSet)).second.end())
-    {
-      resSet.insert(*iter);
-    }
-  }
+  base_t resSet = mergeSets(fSetIter->second, sSetIter->second, ONLY_FIRST);
 
   auto checkIter = dataSets.find(newSet);
   if (checkIter != dataSets.end())
   {
     dataSets.erase(newSet);
   }
-  dataSets.insert({ newSet, resSet });
+  dataSets.insert({ newSet, std::move(resSet) });
 }
 
 void psarev::intersect(avlTree<std::string, psarev::avlTree<int, std::string>>& dataSets)
@@ -107,22 +178,14 @@ void psarev::intersect(avlTree<std::string, psarev::avlTree<int, std::string>>&
     return;
   }
 
-  avlTree< int, std::string > resSet;
-  for (auto iter = (*fSetIter).second.begin(); iter != (*fSetIter).second.end(); iter++)
-  {
-    auto interSSetIter = (*dataSets.find(sSet)).second.find((*iter).first);
-    if (interSSetIter != (*dataSets.find(sSet)).second.end())
-    {
-      resSet.insert(*iter);
-    }
-  }
+  base_t resSet = mergeSets(fSetIter->second, sSetIter->second, IN_BOTH);
 
   auto checkIter = dataSets.find(newSet);
   if (checkIter != dataSets.end())
   {
     dataSets.erase(newSet);
   }
-  dataSets.insert({ newSet, resSet });
+  dataSets.insert({ newSet, std::move(resSet) });
 }
 
 void psarev::unio(avlTree<std::string, avlTree<int, std::string>>& dataSets)
@@ -138,24 +201,12 @@ void psarev::unio(avlTree<std::string, avlTree<int, std::string>>& dataSets)
     return;
   }
 
-  avlTree< int, std::string > resSet;
-  for (auto iter = (*fSetIter).second.begin(); iter != (*fSetIter).second.end(); iter++)
-  {
-    resSet.insert(*iter);
-  }
-  for (auto iter = (*sSetIter).second.begin(); iter != (*sSetIter).second.end(); iter++)
-  {
-    auto setIter = resSet.find((*iter).first);
-    if (setIter == resSet.end())
-    {
-      resSet.insert(*iter);
-    }
-  }
+  base_t resSet = mergeSets(fSetIter->second, sSetIter->second, ONLY_FIRST | IN_BOTH | ONLY_SECOND);
 
   auto checkIter = dataSets.find(newSet);
   if (checkIter != dataSets.end())
   {
     dataSets.erase(newSet);
   }
-  dataSets.insert({ newSet, resSet });
+  dataSets.insert({ newSet, std::move(resSet) });
 }
@@ -17,7 +17,7 @@ int main(int argc, char* argv[])
     return 2;
   }
 
-  using base_t = psarev::avlTree< long long, std::string >;
+  using base_t = psarev::base_t;
   base_t data;
 
   psarev::fillTree(input, data);
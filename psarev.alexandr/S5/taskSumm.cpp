@@ -7,7 +7,7 @@ psarev::TaskSumm::TaskSumm() :
   valSumm("")
 {}
 
-void psarev::TaskSumm::operator()(const std::pair< const long long, std::string >& dataPair)
+void psarev::TaskSumm::operator()(const std::pair< long long, std::string >& dataPair)
 {
   long long llMax = std::numeric_limits< long long >::max();
   bool overCheck = (keySumm > 0) && (dataPair.first > 0) && (llMax - keySumm < dataPair.first);
@@ -11,7 +11,7 @@ namespace psarev
     TaskSumm();
     ~TaskSumm() = default;
 
-    void operator()(const std::pair< const long long, std::string >& dataPair);
+    void operator()(const std::pair< long long, std::string >& dataPair);
 
     long long getKeySumm();
     std::string getValSumm();
@@ -13,7 +13,7 @@ std::ostream& psarev::outEmpty(std::ostream& out)
   return out;
 }
 
-using base_t = psarev::avlTree< long long, std::string >;
+using base_t = psarev::base_t;
 
 void psarev::fillTree(std::istream& in, base_t& data)
 {
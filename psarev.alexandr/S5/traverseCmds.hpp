@@ -3,13 +3,15 @@
 #include <iostream>
 #include <string>
 #include <avlTree.hpp>
+#include <poolAllocator.hpp>
 
 namespace psarev
 {
   std::ostream& outInvCommand(std::ostream& out);
   std::ostream& outEmpty(std::ostream& out);
 
-  using base_t = psarev::avlTree< long long, std::string >;
+  using base_t = psarev::avlTree< long long, std::string, std::less< long long >,
+    PoolAllocator< std::pair< long long, std::string > > >;
 
   void fillTree(std::istream& in, base_t& data);
 
@@ -1,14 +1,26 @@
 #ifndef AVL_TREE_HPP
 #define AVL_TREE_HPP
+#include <cassert>
 #include <utility>
 #include <algorithm>
 #include <functional>
-#include <stack.hpp>
-#include <queue.hpp>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 namespace psarev
 {
-  template < typename Key, typename Value, typename Compare = std::less< Key > >
+  template < typename Alloc, typename = void >
+  struct hasRelease : std::false_type
+  {};
+
+  template < typename Alloc >
+  struct hasRelease< Alloc, decltype(std::declval< Alloc& >().release()) > : std::true_type
+  {};
+
+  template < typename Key, typename Value, typename Compare = std::less< Key >,
+    typename Allocator = std::allocator< std::pair< Key, Value > > >
   class avlTree
   {
   public:
@@ -24,10 +36,14 @@ namespace psarev
 
     avlTree();
     avlTree(const avlTree& that);
+    avlTree(avlTree&& that) noexcept;
     avlTree(size_t& initSize, dataType& initData);
     avlTree(std::initializer_list< dataType > inList);
     ~avlTree();
 
+    template < typename ForwardIt >
+    static avlTree fromSorted(ForwardIt first, ForwardIt last);
+
     void swap(avlTree& first, avlTree& second) noexcept;
     avlTree& operator=(avlTree that);
     avlTree& operator=(avlTree&& that);
@@ -49,6 +65,10 @@ namespace psarev
 
     std::pair< Iterator, Iterator > equalRange(const Key& key);
 
+    iter select(size_t index);
+    size_t rank(const Key& key) const;
+    size_t countRange(const Key& low, const Key& high) const;
+
     iter find(const Key& key);
     iter insert(dataType& data);
     iter insert(dataType&& data);
@@ -76,18 +96,43 @@ namespace psarev
       Unit* ancest;
       Unit* left;
       Unit* right;
+      size_t size;
+      int height;
 
       Unit(dataType data_, Unit* ancest_ = nullptr, Unit* left_ = nullptr, Unit* right_ = nullptr) :
-        data(data_),
+        data(std::move(data_)),
         ancest(ancest_),
         left(left_),
-        right(right_)
+        right(right_),
+        size(1),
+        height(1)
       {}
     };
 
+    using unitAlloc = typename std::allocator_traits< Allocator >::template rebind_alloc< Unit >;
+    using unitTraits = std::allocator_traits< unitAlloc >;
+
     Unit* treeRoot;
+    unitAlloc alloc;
+
+    Unit* makeUnit(const dataType& data);
+    Unit* makeUnit(dataType&& data);
+    void freeUnit(Unit* unit);
+    void dropUnits(std::true_type);
+    void dropUnits(std::false_type);
+    void destroyUnits(Unit* unit);
+    template < typename ForwardIt >
+    Unit* buildSorted(ForwardIt& first, size_t amount);
+    template < typename UnitP, typename F >
+    static F walkLnR(UnitP wayP, F f);
+    template < typename UnitP, typename F >
+    static F walkRnL(UnitP wayP, F f);
+    template < typename UnitP, typename F >
+    static F walkBre(UnitP root, size_t amount, F f);
 
     size_t getSize(Unit* unit) const;
+    size_t countLess(const Key& key, bool inclusive) const;
+    void updUnit(Unit* unit);
     void undercut(Unit* unit);
     Unit* delUnit(Unit* unit, const Key& key);
 
@@ -104,11 +149,11 @@ namespace psarev
   };
 }
 
-template < typename Key, typename Value, typename Compare >
-class psarev::avlTree< Key, Value, Compare >::ConstIterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
+template < typename Key, typename Value, typename Compare, typename Allocator >
+class psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
 {
 public:
-  friend class avlTree< Key, Value, Compare >;
+  friend class avlTree< Key, Value, Compare, Allocator >;
   using this_t = ConstIterator;
 
   ConstIterator();
@@ -135,25 +180,25 @@ private:
   ConstIterator(Unit* unit_, Unit* root_);
 };
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::ConstIterator::ConstIterator() :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::ConstIterator() :
   unit(nullptr),
   root(nullptr)
 {}
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::ConstIterator::ConstIterator(Iterator that) :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::ConstIterator(Iterator that) :
   unit(that.imIter.unit),
   root(that.imIter.root)
 {}
 
-template< typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::ConstIterator::ConstIterator(Unit* unit_, Unit* root_) :
+template< typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::ConstIterator(Unit* unit_, Unit* root_) :
   unit(unit_), root(root_)
 {}
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::ConstIterator& psarev::avlTree< Key, Value, Compare >::ConstIterator::operator++()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator& psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator++()
 {
   if (unit->right)
   {
@@ -176,16 +221,16 @@ typename psarev::avlTree< Key, Value, Compare >::ConstIterator& psarev::avlTree<
   return *this;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::ConstIterator psarev::avlTree< Key, Value, Compare >::ConstIterator::operator++(int)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator++(int)
 {
   this_t inked(*this);
   ++(*this);
   return inked;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::ConstIterator& psarev::avlTree< Key, Value, Compare >::ConstIterator::operator--()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator& psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator--()
 {
   if (unit == nullptr)
   {
@@ -214,43 +259,43 @@ typename psarev::avlTree< Key, Value, Compare >::ConstIterator& psarev::avlTree<
   return *this;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::ConstIterator psarev::avlTree< Key, Value, Compare >::ConstIterator::operator--(int)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator--(int)
 {
   this_t deked(*this);
   --(*this);
   return deked;
 }
 
-template < typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::ConstIterator::operator*() const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator*() const
 {
   return unit->data;
 }
 
-template < typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType* psarev::avlTree< Key, Value, Compare >::ConstIterator::operator->() const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType* psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator->() const
 {
   return &(unit->data);
 }
 
-template < typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::ConstIterator::operator==(const this_t& that) const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator==(const this_t& that) const
 {
   return unit == that.unit;
 }
 
-template < typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::ConstIterator::operator!=(const this_t& that) const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator::operator!=(const this_t& that) const
 {
   return !(that == *this);
 }
 
-template< typename Key, typename Value, typename Compare >
-class psarev::avlTree< Key, Value, Compare >::Iterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
+template< typename Key, typename Value, typename Compare, typename Allocator >
+class psarev::avlTree< Key, Value, Compare, Allocator >::Iterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
 {
 public:
-  friend class avlTree< Key, Value, Compare >;
+  friend class avlTree< Key, Value, Compare, Allocator >;
   using this_t = Iterator;
   Iterator();
   Iterator(ConstIterator constIter);
@@ -275,84 +320,84 @@ private:
   ConstIterator imIter;
 };
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::Iterator::Iterator() :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::Iterator() :
   imIter(ConstIterator())
 {}
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::Iterator::Iterator(ConstIterator that) :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::Iterator(ConstIterator that) :
   imIter(that)
 {}
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Iterator& psarev::avlTree< Key, Value, Compare >::Iterator::operator++()
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator& psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator++()
 {
   assert(imIter != ConstIterator());
   imIter++;
   return *this;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key, Value, Compare >::Iterator::operator++(int)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator++(int)
 {
   ++imIter;
   return imIter;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Iterator& psarev::avlTree< Key, Value, Compare >::Iterator::operator--()
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator& psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator--()
 {
   assert(imIter != nullptr);
   --imIter;
   return imIter;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key, Value, Compare >::Iterator::operator--(int)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator--(int)
 {
   --imIter;
   return imIter;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::Iterator::operator*()
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator*()
 {
   return imIter.unit->data;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::dataType* psarev::avlTree< Key, Value, Compare >::Iterator::operator->()
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType* psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator->()
 {
   return &(imIter.unit->data);
 }
 
-template< typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::Iterator::operator*() const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator*() const
 {
   return imIter.node_->data;
 }
 
-template< typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType* psarev::avlTree< Key, Value, Compare >::Iterator::operator->() const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType* psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator->() const
 {
   return &(imIter.unit->data);
 }
 
-template< typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::Iterator::operator==(const this_t& that) const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator==(const this_t& that) const
 {
   return imIter == that.imIter;
 }
 
-template< typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::Iterator::operator!=(const this_t& that) const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::Iterator::operator!=(const this_t& that) const
 {
   return !(that == *this);
 }
 
-template < typename Key, typename Value, typename Compare >
-class psarev::avlTree< Key, Value, Compare >::LnRIterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
+template < typename Key, typename Value, typename Compare, typename Allocator >
+class psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
 {
 public:
   friend class avlTree;
@@ -379,18 +424,18 @@ private:
   Unit* unit;
 };
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::LnRIterator::LnRIterator() :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::LnRIterator() :
   unit(nullptr)
 {}
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::LnRIterator::LnRIterator(Unit* unit_) :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::LnRIterator(Unit* unit_) :
   unit(unit_)
 {}
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::LnRIterator& psarev::avlTree< Key, Value, Compare >::LnRIterator::operator++()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator& psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator++()
 {
   if (unit == nullptr)
   {
@@ -420,16 +465,16 @@ typename psarev::avlTree< Key, Value, Compare >::LnRIterator& psarev::avlTree< K
   return *this;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::LnRIterator psarev::avlTree< Key, Value, Compare >::LnRIterator::operator++(int)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator++(int)
 {
   this_t tempo = *this;
   ++(*this);
   return tempo;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::LnRIterator& psarev::avlTree< Key, Value, Compare >::LnRIterator::operator--()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator& psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator--()
 {
   if (unit == nullptr)
   {
@@ -462,53 +507,53 @@ typename psarev::avlTree< Key, Value, Compare >::LnRIterator& psarev::avlTree< K
   return *this;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::LnRIterator psarev::avlTree< Key, Value, Compare >::LnRIterator::operator--(int)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator--(int)
 {
   this_t tempo = *this;
   --(*this);
   return tempo;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::LnRIterator::operator*()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator*()
 {
   return unit->data;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::dataType*
-psarev::avlTree< Key, Value, Compare >::LnRIterator::operator->()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType*
+psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator->()
 {
   return &(unit->data);
 }
 
-template < typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::LnRIterator::operator*() const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator*() const
 {
   return unit->data;
 }
 
-template < typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType* psarev::avlTree< Key, Value, Compare >::LnRIterator::operator->() const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType* psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator->() const
 {
   return &(unit->data);
 }
 
-template < typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::LnRIterator::operator==(const this_t& that) const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator==(const this_t& that) const
 {
   return unit == that.unit;
 }
 
-template < typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::LnRIterator::operator!=(const this_t& that) const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::LnRIterator::operator!=(const this_t& that) const
 {
   return !(*this == that);
 }
 
-template < typename Key, typename Value, typename Compare >
-class psarev::avlTree< Key, Value, Compare >::RnLIterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
+template < typename Key, typename Value, typename Compare, typename Allocator >
+class psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator : public std::iterator< std::bidirectional_iterator_tag, dataType >
 {
 public:
   friend class avlTree;
@@ -535,18 +580,18 @@ private:
   Unit* unit;
 };
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::RnLIterator::RnLIterator() :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::RnLIterator() :
   unit(nullptr)
 {}
 
-template < typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::RnLIterator::RnLIterator(Unit* unit_) :
+template < typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::RnLIterator(Unit* unit_) :
   unit(unit_)
 {}
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::RnLIterator& psarev::avlTree< Key, Value, Compare >::RnLIterator::operator++()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator& psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator++()
 {
   if (unit == nullptr)
   {
@@ -576,16 +621,16 @@ typename psarev::avlTree< Key, Value, Compare >::RnLIterator& psarev::avlTree< K
   return *this;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::RnLIterator psarev::avlTree< Key, Value, Compare >::RnLIterator::operator++(int)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator++(int)
 {
   this_t tempo = *this;
   ++(*this);
   return tempo;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::RnLIterator& psarev::avlTree< Key, Value, Compare >::RnLIterator::operator--()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator& psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator--()
 {
   if (unit == nullptr)
   {
@@ -618,68 +663,76 @@ typename psarev::avlTree< Key, Value, Compare >::RnLIterator& psarev::avlTree< K
   return *this;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::RnLIterator psarev::avlTree< Key, Value, Compare >::RnLIterator::operator--(int)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator--(int)
 {
   this_t tempo = *this;
   --(*this);
   return tempo;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::RnLIterator::operator*()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator*()
 {
   return unit->data;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::dataType*
-psarev::avlTree< Key, Value, Compare >::RnLIterator::operator->()
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType*
+psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator->()
 {
   return &(unit->data);
 }
 
-template < typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType& psarev::avlTree< Key, Value, Compare >::RnLIterator::operator*() const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType& psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator*() const
 {
   return unit->data;
 }
 
-template < typename Key, typename Value, typename Compare >
-const typename psarev::avlTree< Key, Value, Compare >::dataType* psarev::avlTree< Key, Value, Compare >::RnLIterator::operator->() const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+const typename psarev::avlTree< Key, Value, Compare, Allocator >::dataType* psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator->() const
 {
   return &(unit->data);
 }
 
-template < typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::RnLIterator::operator==(const this_t& that) const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator==(const this_t& that) const
 {
   return unit == that.unit;
 }
 
-template < typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::RnLIterator::operator!=(const this_t& that) const
+template < typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::RnLIterator::operator!=(const this_t& that) const
 {
   return !(*this == that);
 }
 
-template< typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::avlTree() :
-  treeRoot(nullptr)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::avlTree() :
+  treeRoot(nullptr),
+  alloc()
 {}
 
-template<typename Key, typename Value, typename Compare>
-psarev::avlTree< Key, Value, Compare >::avlTree(const avlTree& that) :
-  treeRoot(nullptr)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+psarev::avlTree< Key, Value, Compare, Allocator >::avlTree(const avlTree& that) :
+  treeRoot(nullptr),
+  alloc(unitTraits::select_on_container_copy_construction(that.alloc))
 {
-  for (Iterator iter = that.cbegin(); iter != cend(); ++iter)
-  {
-    insert(*iter);
-  }
+  ConstIterator iter = that.cbegin();
+  treeRoot = buildSorted(iter, that.getSize());
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+psarev::avlTree< Key, Value, Compare, Allocator >::avlTree(avlTree&& that) noexcept :
+  treeRoot(that.treeRoot),
+  alloc(std::move(that.alloc))
+{
+  that.treeRoot = nullptr;
 }
 
-template<typename Key, typename Value, typename Compare>
-psarev::avlTree< Key, Value, Compare >::avlTree(size_t& initSize, dataType& initData)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+psarev::avlTree< Key, Value, Compare, Allocator >::avlTree(size_t& initSize, dataType& initData)
 {
   treeRoot = nullptr;
   for (size_t i = 0; i < initSize; ++i)
@@ -688,55 +741,80 @@ psarev::avlTree< Key, Value, Compare >::avlTree(size_t& initSize, dataType& init
   }
 }
 
-template<typename Key, typename Value, typename Compare>
-psarev::avlTree< Key, Value, Compare >::avlTree(std::initializer_list< dataType > inList)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+psarev::avlTree< Key, Value, Compare, Allocator >::avlTree(std::initializer_list< dataType > inList) :
+  treeRoot(nullptr)
 {
+  Compare compare;
+  auto unsorted = std::adjacent_find(inList.begin(), inList.end(),
+    [&compare](const dataType& lhs, const dataType& rhs)
+    {
+      return !compare(lhs.first, rhs.first);
+    });
+  if (unsorted == inList.end())
+  {
+    auto first = inList.begin();
+    treeRoot = buildSorted(first, inList.size());
+    return;
+  }
   for (auto data : inList)
   {
     insert(data);
   }
 }
 
-template< typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >::~avlTree()
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename ForwardIt >
+psarev::avlTree< Key, Value, Compare, Allocator > psarev::avlTree< Key, Value, Compare, Allocator >::fromSorted(ForwardIt first, ForwardIt last)
+{
+  avlTree res;
+  size_t amount = std::distance(first, last);
+  res.treeRoot = res.buildSorted(first, amount);
+  return res;
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >::~avlTree()
 {
   clear();
 }
 
-template< typename Key, typename Value, typename Compare >
-void psarev::avlTree< Key, Value, Compare >::swap(avlTree& first, avlTree& second) noexcept
+template< typename Key, typename Value, typename Compare, typename Allocator >
+void psarev::avlTree< Key, Value, Compare, Allocator >::swap(avlTree& first, avlTree& second) noexcept
 {
   std::swap(first.treeRoot, second.treeRoot);
+  std::swap(first.alloc, second.alloc);
 }
 
-template< typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >& psarev::avlTree< Key, Value, Compare >::operator=(avlTree that)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >& psarev::avlTree< Key, Value, Compare, Allocator >::operator=(avlTree that)
 {
   swap(*this, that);
   return *this;
 }
 
-template< typename Key, typename Value, typename Compare >
-psarev::avlTree< Key, Value, Compare >& psarev::avlTree< Key, Value, Compare >::operator=(avlTree&& that)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+psarev::avlTree< Key, Value, Compare, Allocator >& psarev::avlTree< Key, Value, Compare, Allocator >::operator=(avlTree&& that)
 {
   if (&that != this)
   {
     clear();
+    alloc = std::move(that.alloc);
     treeRoot = std::move(that.treeRoot);
     that.treeRoot = nullptr;
   }
   return *this;
 }
 
-template<typename Key, typename Value, typename Compare>
-void psarev::avlTree< Key, Value, Compare >::clear()
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void psarev::avlTree< Key, Value, Compare, Allocator >::clear()
 {
-  undercut(treeRoot);
+  dropUnits(hasRelease< unitAlloc >());
   treeRoot = nullptr;
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key, Value, Compare >::begin() noexcept
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::begin() noexcept
 {
   if (isEmpty())
   {
@@ -750,8 +828,8 @@ typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key,
   return Iterator(ConstIterator(tempo, treeRoot));
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::ConstIterator psarev::avlTree<Key, Value, Compare>::cbegin() const noexcept
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator psarev::avlTree<Key, Value, Compare, Allocator>::cbegin() const noexcept
 {
   if (isEmpty())
   {
@@ -765,32 +843,32 @@ typename psarev::avlTree< Key, Value, Compare >::ConstIterator psarev::avlTree<K
   return ConstIterator(tempo, treeRoot);
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree<Key, Value, Compare>::end() noexcept
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree<Key, Value, Compare, Allocator>::end() noexcept
 {
   return Iterator(ConstIterator(nullptr, treeRoot));
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::ConstIterator psarev::avlTree<Key, Value, Compare>::cend() const noexcept
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::ConstIterator psarev::avlTree<Key, Value, Compare, Allocator>::cend() const noexcept
 {
   return ConstIterator(nullptr, treeRoot);
 }
 
-template< typename Key, typename Value, typename Compare >
-bool psarev::avlTree< Key, Value, Compare >::isEmpty() const noexcept
+template< typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree< Key, Value, Compare, Allocator >::isEmpty() const noexcept
 {
   return (treeRoot == nullptr);
 }
 
-template<typename Key, typename Value, typename Compare>
-size_t psarev::avlTree< Key, Value, Compare >::getSize() const noexcept
+template<typename Key, typename Value, typename Compare, typename Allocator>
+size_t psarev::avlTree< Key, Value, Compare, Allocator >::getSize() const noexcept
 {
   return getSize(treeRoot);
 }
 
-template<typename Key, typename Value, typename Compare>
-Value& psarev::avlTree<Key, Value, Compare>::at(const Key& key)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+Value& psarev::avlTree<Key, Value, Compare, Allocator>::at(const Key& key)
 {
   Unit* curr = treeRoot;
   Compare compare;
@@ -813,8 +891,8 @@ Value& psarev::avlTree<Key, Value, Compare>::at(const Key& key)
   throw std::out_of_range("Error: No such element exists!");
 }
 
-template<typename Key, typename Value, typename Compare>
-const Value& psarev::avlTree<Key, Value, Compare>::at(const Key& key) const
+template<typename Key, typename Value, typename Compare, typename Allocator>
+const Value& psarev::avlTree<Key, Value, Compare, Allocator>::at(const Key& key) const
 {
   Unit* curr = treeRoot;
   Compare compare;
@@ -837,62 +915,36 @@ const Value& psarev::avlTree<Key, Value, Compare>::at(const Key& key) const
   throw std::out_of_range("Error: No such element exists!");
 }
 
-template<typename Key, typename Value, typename Compare>
-Value& psarev::avlTree<Key, Value, Compare>::operator[](const Key& key)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+Value& psarev::avlTree<Key, Value, Compare, Allocator>::operator[](const Key& key)
 {
-  Unit* curr = treeRoot;
-  Compare compare;
-
-  while (curr != nullptr)
+  Iterator found = find(key);
+  if (found == end())
   {
-    if (compare(curr->data.first, key))
-    {
-      curr = curr->right;
-    }
-    else if (compare(key, curr->data.first))
-    {
-      curr = curr->left;
-    }
-    else
-    {
-      return curr->data.second;
-    }
+    found = insert(dataType(key, Value()));
   }
-  throw std::out_of_range("Error: No such element exists!");
+  return found->second;
 }
 
-template<typename Key, typename Value, typename Compare>
-Value& psarev::avlTree<Key, Value, Compare>::operator[](Key&& key)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+Value& psarev::avlTree<Key, Value, Compare, Allocator>::operator[](Key&& key)
 {
-  Unit* curr = treeRoot;
-  Compare compare;
-
-  while (curr != nullptr)
+  Iterator found = find(key);
+  if (found == end())
   {
-    if (compare(curr->data.first, key))
-    {
-      curr = curr->right;
-    }
-    else if (compare(key, curr->data.first))
-    {
-      curr = curr->left;
-    }
-    else
-    {
-      return curr->data.second;
-    }
+    found = insert(dataType(std::move(key), Value()));
   }
-  throw std::out_of_range("Error: No such element exists!");
+  return found->second;
 }
 
-template < typename Key, typename Value, typename Compare >
-using it = typename psarev::avlTree< Key, Value, Compare >::Iterator;
+template < typename Key, typename Value, typename Compare, typename Allocator >
+using it = typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator;
 
-template < typename Key, typename Value, typename Compare >
-using iterPair = std::pair< it< Key, Value, Compare >, it< Key, Value, Compare > >;
+template < typename Key, typename Value, typename Compare, typename Allocator >
+using iterPair = std::pair< it< Key, Value, Compare, Allocator >, it< Key, Value, Compare, Allocator > >;
 
-template<typename Key, typename Value, typename Compare>
-iterPair< Key, Value, Compare > psarev::avlTree<Key, Value, Compare>::equalRange(const Key& key)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+iterPair< Key, Value, Compare, Allocator > psarev::avlTree<Key, Value, Compare, Allocator>::equalRange(const Key& key)
 {
   Unit* unit = treeRoot;
   Iterator startIt = begin();
@@ -917,8 +969,49 @@ iterPair< Key, Value, Compare > psarev::avlTree<Key, Value, Compare>::equalRange
   return std::make_pair(Iterator(nullptr), Iterator(nullptr));
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key, Value, Compare >::find(const Key& key)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::select(size_t index)
+{
+  Unit* tempo = treeRoot;
+  while (tempo != nullptr)
+  {
+    size_t leftSize = getSize(tempo->left);
+    if (index < leftSize)
+    {
+      tempo = tempo->left;
+    }
+    else if (index > leftSize)
+    {
+      index -= leftSize + 1;
+      tempo = tempo->right;
+    }
+    else
+    {
+      return Iterator(ConstIterator(tempo, treeRoot));
+    }
+  }
+  return end();
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+size_t psarev::avlTree< Key, Value, Compare, Allocator >::rank(const Key& key) const
+{
+  return countLess(key, false);
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+size_t psarev::avlTree< Key, Value, Compare, Allocator >::countRange(const Key& low, const Key& high) const
+{
+  Compare compare;
+  if (compare(high, low))
+  {
+    return 0;
+  }
+  return countLess(high, true) - countLess(low, false);
+}
+
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::find(const Key& key)
 {
   Compare compare;
   Unit* tempo = treeRoot;
@@ -941,22 +1034,23 @@ typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key,
   return end();
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key, Value, Compare >::insert(dataType& data)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::insert(dataType& data)
 {
   treeRoot = updData(treeRoot, data);
   return find(data.first);
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Iterator psarev::avlTree< Key, Value, Compare >::insert(dataType&& data)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Iterator psarev::avlTree< Key, Value, Compare, Allocator >::insert(dataType&& data)
 {
+  Key key = data.first;
   treeRoot = updData(treeRoot, std::move(data));
-  return find(data.first);
+  return find(key);
 }
 
-template< typename Key, typename Value, typename Compare >
-bool psarev::avlTree<Key, Value, Compare>::erase(const Key& key)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+bool psarev::avlTree<Key, Value, Compare, Allocator>::erase(const Key& key)
 {
   if (find(key) != end())
   {
@@ -966,199 +1060,328 @@ bool psarev::avlTree<Key, Value, Compare>::erase(const Key& key)
   return false;
 }
 
-template< typename Key, typename Value, typename Compare >
+template< typename Key, typename Value, typename Compare, typename Allocator >
 template< typename F >
-F psarev::avlTree<Key, Value, Compare>::traverseLnR(F f) const
+F psarev::avlTree<Key, Value, Compare, Allocator>::traverseLnR(F f) const
 {
-  Stack< const Unit* > ancestors;
-  const Unit* wayP = treeRoot;
+  return walkLnR< const Unit* >(treeRoot, f);
+}
 
-  while (!ancestors.isEmpty() || wayP != nullptr)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::traverseRnL(F f) const
+{
+  return walkRnL< const Unit* >(treeRoot, f);
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::traverseBre(F f) const
+{
+  return walkBre< const Unit* >(treeRoot, getSize(), f);
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::traverseLnR(F f)
+{
+  return walkLnR(treeRoot, f);
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::traverseRnL(F f)
+{
+  return walkRnL(treeRoot, f);
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::traverseBre(F f)
+{
+  return walkBre(treeRoot, getSize(), f);
+}
+
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename UnitP, typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::walkLnR(UnitP wayP, F f)
+{
+  if (wayP == nullptr)
   {
-    while (wayP != nullptr)
-    {
-      ancestors.push(wayP);
-      wayP = wayP->left;
-    }
+    return f;
+  }
+  while (wayP->left != nullptr)
+  {
+    wayP = wayP->left;
+  }
 
-    if (!ancestors.isEmpty())
+  while (wayP != nullptr)
+  {
+    f(wayP->data);
+    if (wayP->right != nullptr)
     {
-      wayP = ancestors.getTop();
-      ancestors.pop();
-
-      f(wayP->data);
       wayP = wayP->right;
+      while (wayP->left != nullptr)
+      {
+        wayP = wayP->left;
+      }
+    }
+    else
+    {
+      UnitP tAncest = wayP->ancest;
+      while (tAncest != nullptr && wayP == tAncest->right)
+      {
+        wayP = tAncest;
+        tAncest = wayP->ancest;
+      }
+      wayP = tAncest;
     }
   }
   return f;
 }
 
-template< typename Key, typename Value, typename Compare >
-template< typename F >
-F psarev::avlTree<Key, Value, Compare>::traverseRnL(F f) const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename UnitP, typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::walkRnL(UnitP wayP, F f)
 {
-  Stack< const Unit* > ancestors;
-  const Unit* wayP = treeRoot;
+  if (wayP == nullptr)
+  {
+    return f;
+  }
+  while (wayP->right != nullptr)
+  {
+    wayP = wayP->right;
+  }
 
-  while (!ancestors.isEmpty() || wayP != nullptr)
+  while (wayP != nullptr)
   {
-    while (wayP != nullptr)
+    f(wayP->data);
+    if (wayP->left != nullptr)
     {
-      ancestors.push(wayP);
-      wayP = wayP->right;
+      wayP = wayP->left;
+      while (wayP->right != nullptr)
+      {
+        wayP = wayP->right;
+      }
     }
-
-    if (!ancestors.isEmpty())
+    else
     {
-      wayP = ancestors.getTop();
-      ancestors.pop();
-
-      f(wayP->data);
-      wayP = wayP->left;
+      UnitP tAncest = wayP->ancest;
+      while (tAncest != nullptr && wayP == tAncest->left)
+      {
+        wayP = tAncest;
+        tAncest = wayP->ancest;
+      }
+      wayP = tAncest;
     }
   }
   return f;
 }
 
-template< typename Key, typename Value, typename Compare >
-template< typename F >
-F psarev::avlTree<Key, Value, Compare>::traverseBre(F f) const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename UnitP, typename F >
+F psarev::avlTree<Key, Value, Compare, Allocator>::walkBre(UnitP root, size_t amount, F f)
 {
-  if (isEmpty())
+  if (root == nullptr)
   {
     return f;
   }
-  Queue< const Unit* > stage;
-
-  stage.push(treeRoot);
-  while (!stage.isEmpty())
+  // a level-order frontier never holds more than (n + 1) / 2 units
+  size_t capacity = amount / 2 + 2;
+  std::vector< UnitP > stage(capacity);
+  size_t head = 0;
+  size_t tail = 0;
+
+  stage[tail++] = root;
+  while (head != tail)
   {
-    const Unit* unit = stage.getFront();
+    UnitP unit = stage[head];
+    head = (head + 1 == capacity) ? 0 : head + 1;
     f(unit->data);
-    stage.pop();
 
     if (unit->left != nullptr)
     {
-      stage.push(unit->left);
+      stage[tail] = unit->left;
+      tail = (tail + 1 == capacity) ? 0 : tail + 1;
     }
 
     if (unit->right != nullptr)
     {
-      stage.push(unit->right);
+      stage[tail] = unit->right;
+      tail = (tail + 1 == capacity) ? 0 : tail + 1;
     }
   }
   return f;
 }
 
-template< typename Key, typename Value, typename Compare >
-template< typename F >
-F psarev::avlTree<Key, Value, Compare>::traverseLnR(F f)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree< Key, Value, Compare, Allocator >::makeUnit(const dataType& data)
 {
-  Stack< Unit* > ancestors;
-  Unit* wayP = treeRoot;
-
-  while (!ancestors.isEmpty() || wayP != nullptr)
+  Unit* unit = unitTraits::allocate(alloc, 1);
+  try
   {
-    while (wayP != nullptr)
-    {
-      ancestors.push(wayP);
-      wayP = wayP->left;
-    }
-
-    if (!ancestors.isEmpty())
-    {
-      wayP = ancestors.getTop();
-      ancestors.pop();
+    unitTraits::construct(alloc, unit, data);
+  }
+  catch (...)
+  {
+    unitTraits::deallocate(alloc, unit, 1);
+    throw;
+  }
+  return unit;
+}
 
-      f(wayP->data);
-      wayP = wayP->right;
-    }
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree< Key, Value, Compare, Allocator >::makeUnit(dataType&& data)
+{
+  Unit* unit = unitTraits::allocate(alloc, 1);
+  try
+  {
+    unitTraits::construct(alloc, unit, std::move(data));
   }
-  return f;
+  catch (...)
+  {
+    unitTraits::deallocate(alloc, unit, 1);
+    throw;
+  }
+  return unit;
 }
 
-template< typename Key, typename Value, typename Compare >
-template< typename F >
-F psarev::avlTree<Key, Value, Compare>::traverseRnL(F f)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+void psarev::avlTree< Key, Value, Compare, Allocator >::freeUnit(Unit* unit)
 {
-  Stack< Unit* > ancestors;
-  Unit* wayP = treeRoot;
+  unitTraits::destroy(alloc, unit);
+  unitTraits::deallocate(alloc, unit, 1);
+}
 
-  while (!ancestors.isEmpty() || wayP != nullptr)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+void psarev::avlTree< Key, Value, Compare, Allocator >::dropUnits(std::true_type)
+{
+  if (!alloc.isUnique())
   {
-    while (wayP != nullptr)
-    {
-      ancestors.push(wayP);
-      wayP = wayP->right;
-    }
+    undercut(treeRoot);
+    return;
+  }
+  if (!std::is_trivially_destructible< Unit >::value)
+  {
+    destroyUnits(treeRoot);
+  }
+  alloc.release();
+}
 
-    if (!ancestors.isEmpty())
-    {
-      wayP = ancestors.getTop();
-      ancestors.pop();
+template< typename Key, typename Value, typename Compare, typename Allocator >
+void psarev::avlTree< Key, Value, Compare, Allocator >::dropUnits(std::false_type)
+{
+  undercut(treeRoot);
+}
 
-      f(wayP->data);
-      wayP = wayP->left;
-    }
+template< typename Key, typename Value, typename Compare, typename Allocator >
+template< typename ForwardIt >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree< Key, Value, Compare, Allocator >::buildSorted(ForwardIt& first, size_t amount)
+{
+  if (amount == 0)
+  {
+    return nullptr;
   }
-  return f;
+  size_t leftAmount = amount / 2;
+  Unit* left = buildSorted(first, leftAmount);
+  Unit* unit = nullptr;
+  try
+  {
+    unit = makeUnit(*first);
+  }
+  catch (...)
+  {
+    undercut(left);
+    throw;
+  }
+  ++first;
+  unit->left = left;
+  if (left != nullptr)
+  {
+    left->ancest = unit;
+  }
+  try
+  {
+    unit->right = buildSorted(first, amount - leftAmount - 1);
+  }
+  catch (...)
+  {
+    undercut(unit);
+    throw;
+  }
+  if (unit->right != nullptr)
+  {
+    unit->right->ancest = unit;
+  }
+  updUnit(unit);
+  return unit;
 }
 
-template< typename Key, typename Value, typename Compare >
-template< typename F >
-F psarev::avlTree<Key, Value, Compare>::traverseBre(F f)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+void psarev::avlTree< Key, Value, Compare, Allocator >::destroyUnits(Unit* unit)
 {
-  if (isEmpty())
+  if (unit != nullptr)
   {
-    return f;
+    destroyUnits(unit->left);
+    destroyUnits(unit->right);
+    unitTraits::destroy(alloc, unit);
   }
-  Queue< Unit* > stage;
+}
 
-  stage.push(treeRoot);
-  while (!stage.isEmpty())
+template<typename Key, typename Value, typename Compare, typename Allocator>
+size_t psarev::avlTree<Key, Value, Compare, Allocator>::getSize(Unit* unit) const
+{
+  if (unit == nullptr)
   {
-    Unit* unit = stage.getFront();
-    f(unit->data);
-    stage.pop();
+    return 0;
+  }
+  return unit->size;
+}
 
-    if (unit->left != nullptr)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+size_t psarev::avlTree< Key, Value, Compare, Allocator >::countLess(const Key& key, bool inclusive) const
+{
+  Compare compare;
+  size_t res = 0;
+  Unit* tempo = treeRoot;
+  while (tempo != nullptr)
+  {
+    bool goRight = inclusive ? !compare(key, tempo->data.first) : compare(tempo->data.first, key);
+    if (goRight)
     {
-      stage.push(unit->left);
+      res += getSize(tempo->left) + 1;
+      tempo = tempo->right;
     }
-
-    if (unit->right != nullptr)
+    else
     {
-      stage.push(unit->right);
+      tempo = tempo->left;
     }
   }
-  return f;
+  return res;
 }
 
-template<typename Key, typename Value, typename Compare>
-size_t psarev::avlTree<Key, Value, Compare>::getSize(Unit* unit) const
+template< typename Key, typename Value, typename Compare, typename Allocator >
+void psarev::avlTree< Key, Value, Compare, Allocator >::updUnit(Unit* unit)
 {
-  if (unit == nullptr)
-  {
-    return 0;
-  }
-  size_t res = getSize(unit->left) + getSize(unit->right) + 1;
-  return res;
+  int leftHeight = getHeight(unit->left);
+  int rightHeight = getHeight(unit->right);
+  unit->height = (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+  unit->size = getSize(unit->left) + getSize(unit->right) + 1;
 }
 
-template<typename Key, typename Value, typename Compare>
-void psarev::avlTree<Key, Value, Compare>::undercut(Unit* unit)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+void psarev::avlTree<Key, Value, Compare, Allocator>::undercut(Unit* unit)
 {
   if (unit != nullptr)
   {
     undercut(unit->left);
     undercut(unit->right);
-    delete unit;
-    unit = nullptr;
+    freeUnit(unit);
   }
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Value, Compare >::delUnit(Unit* unit, const Key& key)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree< Key, Value, Compare, Allocator >::delUnit(Unit* unit, const Key& key)
 {
   Compare compare;
   if (unit == nullptr)
@@ -1169,30 +1392,31 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Val
   if (compare(key, unit->data.first))
   {
     unit->left = delUnit(unit->left, key);
+    if (unit->left != nullptr)
+    {
+      unit->left->ancest = unit;
+    }
   }
   else if (compare(unit->data.first, key))
   {
     unit->right = delUnit(unit->right, key);
+    if (unit->right != nullptr)
+    {
+      unit->right->ancest = unit;
+    }
   }
   else
   {
     Unit* tempo = nullptr;
-    if (unit->left == nullptr && unit->right == nullptr)
-    {
-      delete unit;
-      return nullptr;
-    }
-    else if (unit->right == nullptr)
-    {
-      tempo = unit->left;
-      *unit = *tempo;
-      delete tempo;
-    }
-    else if (unit->left == nullptr)
+    if (unit->left == nullptr || unit->right == nullptr)
     {
-      tempo = unit->right;
-      *unit = *tempo;
-      delete tempo;
+      tempo = (unit->left != nullptr) ? unit->left : unit->right;
+      if (tempo != nullptr)
+      {
+        tempo->ancest = unit->ancest;
+      }
+      freeUnit(unit);
+      return tempo;
     }
     else
     {
@@ -1203,6 +1427,10 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Val
       }
       unit->data = tempo->data;
       unit->right = delUnit(unit->right, tempo->data.first);
+      if (unit->right != nullptr)
+      {
+        unit->right->ancest = unit;
+      }
     }
   }
 
@@ -1210,9 +1438,10 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Val
   return unit;
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Value, Compare>::makeBal(Unit* unit)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree<Key, Value, Compare, Allocator>::makeBal(Unit* unit)
 {
+  updUnit(unit);
   int balFact = getFact(unit);
   if (balFact == 2)
   {
@@ -1242,8 +1471,8 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Valu
   return unit;
 }
 
-template<typename Key, typename Value, typename Compare>
-int psarev::avlTree<Key, Value, Compare>::getFact(Unit* unit)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+int psarev::avlTree<Key, Value, Compare, Allocator>::getFact(Unit* unit)
 {
   if (unit == nullptr)
   {
@@ -1252,20 +1481,18 @@ int psarev::avlTree<Key, Value, Compare>::getFact(Unit* unit)
   return getHeight(unit->left) - getHeight(unit->right);
 }
 
-template < typename Key, typename Value, typename Compare >
-int psarev::avlTree< Key, Value, Compare >::getHeight(Unit* unit)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+int psarev::avlTree< Key, Value, Compare, Allocator >::getHeight(Unit* unit)
 {
   if (unit == nullptr)
   {
     return 0;
   }
-  int leftHeight = getHeight(unit->left);
-  int rightHeight = getHeight(unit->right);
-  return (leftHeight > rightHeight ? leftHeight : rightHeight) + 1;
+  return unit->height;
 }
 
-template< typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Value, Compare>::lTurn(Unit* moveU)
+template< typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree<Key, Value, Compare, Allocator>::lTurn(Unit* moveU)
 {
   Unit* tempo = moveU->right;
   Unit* ancest = moveU->ancest;
@@ -1279,11 +1506,13 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Valu
   tempo->left = moveU;
   tempo->left->ancest = tempo;
   tempo->ancest = ancest;
+  updUnit(moveU);
+  updUnit(tempo);
   return tempo;
 }
 
-template<typename Key, typename Value, typename Compare>
-typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Value, Compare>::rTurn(Unit* moveU)
+template<typename Key, typename Value, typename Compare, typename Allocator>
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree<Key, Value, Compare, Allocator>::rTurn(Unit* moveU)
 {
   Unit* tempo = moveU->left;
   Unit* ancest = moveU->ancest;
@@ -1297,16 +1526,18 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree<Key, Valu
   tempo->right = moveU;
   tempo->right->ancest = tempo;
   tempo->ancest = ancest;
+  updUnit(moveU);
+  updUnit(tempo);
   return tempo;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Value, Compare >::updData(Unit* unit, const dataType& newData)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree< Key, Value, Compare, Allocator >::updData(Unit* unit, const dataType& newData)
 {
   Compare compare;
   if (unit == nullptr)
   {
-    unit = new Unit(newData);
+    unit = makeUnit(newData);
     return unit;
   }
   else
@@ -1327,13 +1558,13 @@ typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Val
   return unit;
 }
 
-template < typename Key, typename Value, typename Compare >
-typename psarev::avlTree< Key, Value, Compare >::Unit* psarev::avlTree< Key, Value, Compare >::updData(Unit* unit, dataType&& newData)
+template < typename Key, typename Value, typename Compare, typename Allocator >
+typename psarev::avlTree< Key, Value, Compare, Allocator >::Unit* psarev::avlTree< Key, Value, Compare, Allocator >::updData(Unit* unit, dataType&& newData)
 {
   Compare compare;
   if (unit == nullptr)
   {
-    unit = new Unit(std::move(newData));
+    unit = makeUnit(std::move(newData));
     return unit;
   }
   else
@@ -20,8 +20,13 @@ namespace psarev
     List(size_t amount, const T& data);
     List(iter beginThat, iter endThat);
     List(std::initializer_list< T > ilThat);
+    List(const List< T >& other);
+    List(List< T >&& other) noexcept;
     ~List();
 
+    List< T >& operator=(const List< T >& other);
+    List< T >& operator=(List< T >&& other) noexcept;
+
     T& operator[](const size_t index);
 
     void popFront();
@@ -367,6 +372,8 @@ psarev::List< T >::List()
 template< typename T >
 psarev::List< T >::List(size_t amount)
 {
+  head = nullptr;
+  tail = nullptr;
   size = 0;
   for (int i = 1; i <= amount; i++)
   {
@@ -377,6 +384,8 @@ psarev::List< T >::List(size_t amount)
 template< typename T >
 psarev::List< T >::List(size_t amount, const T& data)
 {
+  head = nullptr;
+  tail = nullptr;
   size = 0;
   for (int i = 0; i <= amount; i++)
   {
@@ -387,6 +396,8 @@ psarev::List< T >::List(size_t amount, const T& data)
 template< typename T >
 psarev::List< T >::List(iter beginThat, iter endThat)
 {
+  head = nullptr;
+  tail = nullptr;
   size = 0;
   while (beginThat != endThat)
   {
@@ -398,6 +409,8 @@ psarev::List< T >::List(iter beginThat, iter endThat)
 template<typename T>
 psarev::List<T>::List(std::initializer_list<T> ilThat)
 {
+  head = nullptr;
+  tail = nullptr;
   size = 0;
   for (T data : ilThat)
   {
@@ -405,6 +418,51 @@ psarev::List<T>::List(std::initializer_list<T> ilThat)
   }
 }
 
+template< typename T >
+psarev::List< T >::List(const List< T >& other)
+{
+  head = nullptr;
+  tail = nullptr;
+  size = 0;
+  for (Unit* cur = other.head; cur != nullptr; cur = cur->next)
+  {
+    pushBack(cur->data);
+  }
+}
+
+template< typename T >
+psarev::List< T >::List(List< T >&& other) noexcept
+{
+  head = other.head;
+  tail = other.tail;
+  size = other.size;
+  other.head = nullptr;
+  other.tail = nullptr;
+  other.size = 0;
+}
+
+template< typename T >
+psarev::List< T >& psarev::List< T >::operator=(const List< T >& other)
+{
+  if (this != &other)
+  {
+    List< T > tempo(other);
+    swap(tempo);
+  }
+  return *this;
+}
+
+template< typename T >
+psarev::List< T >& psarev::List< T >::operator=(List< T >&& other) noexcept
+{
+  if (this != &other)
+  {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
 template< typename T >
 psarev::List< T >::~List()
 {
@@ -418,6 +476,14 @@ void psarev::List< T >::popFront()
   head = head->next;
   delete tempo;
   size--;
+  if (head == nullptr)
+  {
+    tail = nullptr;
+  }
+  else
+  {
+    head->prev = nullptr;
+  }
 }
 
 template< typename T >
@@ -427,6 +493,14 @@ void psarev::List< T >::popBack()
   tail = tail->prev;
   delete delUnit;
   size--;
+  if (tail == nullptr)
+  {
+    head = nullptr;
+  }
+  else
+  {
+    tail->next = nullptr;
+  }
 }
 
 template< typename T >
@@ -437,6 +511,10 @@ void psarev::List< T >::pushFront(T& data)
   {
     head->next->prev = head;
   }
+  else
+  {
+    tail = head;
+  }
   size++;
 }
 
@@ -465,6 +543,10 @@ void psarev::List< T >::pushFront(const T& data)
   {
     head->next->prev = head;
   }
+  else
+  {
+    tail = head;
+  }
   size++;
 }
 
@@ -493,6 +575,10 @@ void psarev::List<T>::pushFront(T&& data)
   {
     head->next->prev = head;
   }
+  else
+  {
+    tail = head;
+  }
   size++;
 }
 
@@ -752,9 +838,12 @@ T& psarev::List< T >::getBack() const
 template< typename T >
 void psarev::List< T >::swap(List< T >& targetList) noexcept
 {
-  Unit tempoH = targetList.head;
+  Unit* tempoH = targetList.head;
   targetList.head = head;
   head = tempoH;
+  Unit* tempoT = targetList.tail;
+  targetList.tail = tail;
+  tail = tempoT;
   size_t tempoS = targetList.size;
   targetList.size = size;
   size = tempoS;
@@ -0,0 +1,254 @@
+#ifndef POOL_ALLOCATOR_HPP
+#define POOL_ALLOCATOR_HPP
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace psarev
+{
+  template < size_t ChunkSize >
+  class SlotPool
+  {
+  public:
+    SlotPool() noexcept;
+    SlotPool(const SlotPool& that) = delete;
+    ~SlotPool();
+
+    SlotPool& operator=(const SlotPool& that) = delete;
+
+    void* allocate(size_t slotSize);
+    void deallocate(void* ptr, size_t slotSize) noexcept;
+    void release() noexcept;
+
+  private:
+    struct Slot
+    {
+      Slot* next;
+    };
+
+    struct Chunk
+    {
+      Chunk* next;
+    };
+
+    struct Bin
+    {
+      Bin* next;
+      size_t slotSize;
+      char* slots;
+      size_t used;
+      Slot* freeSlots;
+    };
+
+    Chunk* chunks;
+    Bin* bins;
+
+    Bin* findBin(size_t slotSize) const noexcept;
+  };
+
+  template < typename T, size_t ChunkSize = 512 >
+  class PoolAllocator
+  {
+  public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    template < typename U >
+    struct rebind
+    {
+      using other = PoolAllocator< U, ChunkSize >;
+    };
+
+    PoolAllocator();
+    PoolAllocator(const PoolAllocator& that) noexcept;
+    template < typename U >
+    PoolAllocator(const PoolAllocator< U, ChunkSize >& that) noexcept;
+
+    PoolAllocator& operator=(const PoolAllocator& that) noexcept;
+
+    T* allocate(size_t amount);
+    void deallocate(T* ptr, size_t amount) noexcept;
+    PoolAllocator select_on_container_copy_construction() const;
+
+    bool isUnique() const noexcept;
+    void release() noexcept;
+
+    template < typename U >
+    bool operator==(const PoolAllocator< U, ChunkSize >& that) const noexcept;
+    template < typename U >
+    bool operator!=(const PoolAllocator< U, ChunkSize >& that) const noexcept;
+
+  private:
+    template < typename U, size_t N >
+    friend class PoolAllocator;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+
+    union Slot
+    {
+      void* next;
+      typename std::aligned_storage< sizeof(T), alignof(T) >::type storage;
+    };
+
+    std::shared_ptr< SlotPool< ChunkSize > > pool;
+  };
+}
+
+template < size_t ChunkSize >
+psarev::SlotPool< ChunkSize >::SlotPool() noexcept :
+  chunks(nullptr),
+  bins(nullptr)
+{}
+
+template < size_t ChunkSize >
+psarev::SlotPool< ChunkSize >::~SlotPool()
+{
+  release();
+}
+
+template < size_t ChunkSize >
+void* psarev::SlotPool< ChunkSize >::allocate(size_t slotSize)
+{
+  const size_t align = alignof(std::max_align_t);
+  const size_t headerSize = (sizeof(Chunk) + align - 1) / align * align;
+  Bin* bin = findBin(slotSize);
+  if (bin == nullptr)
+  {
+    bin = new Bin{ bins, slotSize, nullptr, ChunkSize, nullptr };
+    bins = bin;
+  }
+  if (bin->freeSlots != nullptr)
+  {
+    Slot* slot = bin->freeSlots;
+    bin->freeSlots = slot->next;
+    return slot;
+  }
+  if (bin->used == ChunkSize)
+  {
+    Chunk* chunk = static_cast< Chunk* >(::operator new(headerSize + ChunkSize * slotSize));
+    chunk->next = chunks;
+    chunks = chunk;
+    bin->slots = reinterpret_cast< char* >(chunk) + headerSize;
+    bin->used = 0;
+  }
+  return bin->slots + slotSize * bin->used++;
+}
+
+template < size_t ChunkSize >
+void psarev::SlotPool< ChunkSize >::deallocate(void* ptr, size_t slotSize) noexcept
+{
+  Bin* bin = findBin(slotSize);
+  bin->freeSlots = new (ptr) Slot{ bin->freeSlots };
+}
+
+template < size_t ChunkSize >
+void psarev::SlotPool< ChunkSize >::release() noexcept
+{
+  while (chunks != nullptr)
+  {
+    Chunk* tempo = chunks;
+    chunks = chunks->next;
+    ::operator delete(tempo);
+  }
+  while (bins != nullptr)
+  {
+    Bin* tempo = bins;
+    bins = bins->next;
+    delete tempo;
+  }
+}
+
+template < size_t ChunkSize >
+typename psarev::SlotPool< ChunkSize >::Bin* psarev::SlotPool< ChunkSize >::findBin(size_t slotSize) const noexcept
+{
+  Bin* bin = bins;
+  while (bin != nullptr && bin->slotSize != slotSize)
+  {
+    bin = bin->next;
+  }
+  return bin;
+}
+
+template < typename T, size_t ChunkSize >
+psarev::PoolAllocator< T, ChunkSize >::PoolAllocator() :
+  pool(std::make_shared< SlotPool< ChunkSize > >())
+{}
+
+template < typename T, size_t ChunkSize >
+psarev::PoolAllocator< T, ChunkSize >::PoolAllocator(const PoolAllocator& that) noexcept :
+  pool(that.pool)
+{}
+
+template < typename T, size_t ChunkSize >
+template < typename U >
+psarev::PoolAllocator< T, ChunkSize >::PoolAllocator(const PoolAllocator< U, ChunkSize >& that) noexcept :
+  pool(that.pool)
+{}
+
+template < typename T, size_t ChunkSize >
+psarev::PoolAllocator< T, ChunkSize >& psarev::PoolAllocator< T, ChunkSize >::operator=(const PoolAllocator& that) noexcept
+{
+  pool = that.pool;
+  return *this;
+}
+
+template < typename T, size_t ChunkSize >
+T* psarev::PoolAllocator< T, ChunkSize >::allocate(size_t amount)
+{
+  if (amount != 1)
+  {
+    return static_cast< T* >(::operator new(amount * sizeof(T)));
+  }
+  return static_cast< T* >(pool->allocate(sizeof(Slot)));
+}
+
+template < typename T, size_t ChunkSize >
+void psarev::PoolAllocator< T, ChunkSize >::deallocate(T* ptr, size_t amount) noexcept
+{
+  if (amount != 1)
+  {
+    ::operator delete(ptr);
+    return;
+  }
+  pool->deallocate(ptr, sizeof(Slot));
+}
+
+template < typename T, size_t ChunkSize >
+psarev::PoolAllocator< T, ChunkSize > psarev::PoolAllocator< T, ChunkSize >::select_on_container_copy_construction() const
+{
+  return PoolAllocator();
+}
+
+template < typename T, size_t ChunkSize >
+bool psarev::PoolAllocator< T, ChunkSize >::isUnique() const noexcept
+{
+  return pool.use_count() == 1;
+}
+
+template < typename T, size_t ChunkSize >
+void psarev::PoolAllocator< T, ChunkSize >::release() noexcept
+{
+  if (isUnique())
+  {
+    pool->release();
+  }
+}
+
+template < typename T, size_t ChunkSize >
+template < typename U >
+bool psarev::PoolAllocator< T, ChunkSize >::operator==(const PoolAllocator< U, ChunkSize >& that) const noexcept
+{
+  return pool == that.pool;
+}
+
+template < typename T, size_t ChunkSize >
+template < typename U >
+bool psarev::PoolAllocator< T, ChunkSize >::operator!=(const PoolAllocator< U, ChunkSize >& that) const noexcept
+{
+  return !(*this == that);
+}
+
+#endif
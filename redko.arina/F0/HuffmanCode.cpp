@@ -1,6 +1,11 @@
 #include "HuffmanCode.hpp"
 #include <string>
 #include <algorithm>
+#include <cctype>
+#include <exception>
+#include <limits>
+#include <thread>
+#include <vector>
 #include "delimiter.hpp"
 
 redko::HuffmanCode::HuffmanCode():
@@ -19,6 +24,22 @@ redko::HuffmanCode::HuffmanCode(const std::string & src):
   root_(nullptr)
 {}
 
+redko::HuffmanCode::HuffmanCode(std::string && src):
+  charsFreq_(),
+  charsCode_(),
+  sourseText_(std::move(src)),
+  encodedText_(),
+  root_(nullptr)
+{}
+
+redko::HuffmanCode::HuffmanCode(const BSTree< char, std::string > & alph):
+  charsFreq_(),
+  charsCode_(alph),
+  sourseText_(),
+  encodedText_(),
+  root_(nullptr)
+{}
+
 redko::HuffmanCode::HuffmanCode(const std::string & res, const BSTree< char, std::string > & alph):
   charsFreq_(),
   charsCode_(alph),
@@ -27,34 +48,195 @@ redko::HuffmanCode::HuffmanCode(const std::string & res, const BSTree< char, std
   root_(nullptr)
 {}
 
-std::string redko::HuffmanCode::getEncoded()
+redko::HuffmanCode::HuffmanCode(HuffmanCode && other) noexcept:
+  charsFreq_(std::move(other.charsFreq_)),
+  charsCode_(std::move(other.charsCode_)),
+  sourseText_(std::move(other.sourseText_)),
+  encodedText_(std::move(other.encodedText_)),
+  root_(other.root_)
+{
+  other.root_ = nullptr;
+}
+
+redko::HuffmanCode::~HuffmanCode()
+{
+  deleteTree(root_);
+}
+
+redko::HuffmanCode & redko::HuffmanCode::operator=(HuffmanCode && other) noexcept
+{
+  if (this != &other)
+  {
+    deleteTree(root_);
+    charsFreq_ = std::move(other.charsFreq_);
+    charsCode_ = std::move(other.charsCode_);
+    sourseText_ = std::move(other.sourseText_);
+    encodedText_ = std::move(other.encodedText_);
+    root_ = other.root_;
+    other.root_ = nullptr;
+  }
+  return *this;
+}
+
+const std::string & redko::HuffmanCode::getEncoded() const
 {
   return encodedText_;
 }
 
-std::string redko::HuffmanCode::getDecoded()
+const std::string & redko::HuffmanCode::getDecoded() const
 {
   return sourseText_;
 }
 
-redko::BSTree< char, std::string > redko::HuffmanCode::getEncoding()
+const redko::BSTree< char, std::string > & redko::HuffmanCode::getEncoding() const
 {
   return charsCode_;
 }
 
 void redko::HuffmanCode::encode()
 {
-  countFreq();
+  const size_t alphabetSize = 256;
+  size_t blocks = countBlocks();
+  std::vector< unsigned long > blockFreqs(blocks * alphabetSize, 0);
+  forEachBlock(blocks, [&](size_t block, size_t first, size_t last)
+  {
+    unsigned long * freqs = blockFreqs.data() + block * alphabetSize;
+    for (size_t i = first; i < last; ++i)
+    {
+      ++freqs[static_cast< unsigned char >(sourseText_[i])];
+    }
+  });
+
+  std::vector< unsigned long > freqs(alphabetSize, 0);
+  for (size_t i = 0; i < blocks * alphabetSize; ++i)
+  {
+    freqs[i % alphabetSize] += blockFreqs[i];
+  }
+  countFreq(freqs.data());
   makeCodeTree();
   makeCharCode(root_, "");
-  for (auto i : sourseText_)
+
+  std::vector< std::string > codes(alphabetSize);
+  for (auto i : charsCode_)
   {
-    encodedText_ += charsCode_.find(i)->second;
+    codes[static_cast< unsigned char >(i.first)] = i.second;
+  }
+  std::vector< size_t > offsets(blocks + 1, 0);
+  for (size_t block = 0; block < blocks; ++block)
+  {
+    size_t length = 0;
+    for (size_t c = 0; c < alphabetSize; ++c)
+    {
+      length += blockFreqs[block * alphabetSize + c] * codes[c].size();
+    }
+    offsets[block + 1] = offsets[block] + length;
   }
+
+  encodedText_.assign(offsets[blocks], '0');
+  forEachBlock(blocks, [&](size_t block, size_t first, size_t last)
+  {
+    auto out = encodedText_.begin() + offsets[block];
+    for (size_t i = first; i < last; ++i)
+    {
+      const std::string & code = codes[static_cast< unsigned char >(sourseText_[i])];
+      out = std::copy(code.begin(), code.end(), out);
+    }
+  });
 }
 
 void redko::HuffmanCode::decode()
 {
+  decode(encodedText_.data(), encodedText_.data() + encodedText_.size(), sourseText_);
+}
+
+void redko::HuffmanCode::decode(const char * first, const char * last)
+{
+  decode(first, last, sourseText_);
+}
+
+void redko::HuffmanCode::decode(const char * first, const char * last, std::string & out)
+{
+  makeDecodeTree();
+
+  auto step = [](HuffmanNode * curr, char bit)
+  {
+    if (bit == '0' && curr->left)
+    {
+      return curr->left;
+    }
+    else if (bit == '1' && curr->right)
+    {
+      return curr->right;
+    }
+    return curr;
+  };
+  auto isLeaf = [](const HuffmanNode * node)
+  {
+    return !node->left && !node->right;
+  };
+
+  size_t minLength = std::numeric_limits< size_t >::max();
+  size_t maxLength = 1;
+  for (auto i : charsCode_)
+  {
+    minLength = std::min(minLength, std::max(i.second.size(), static_cast< size_t >(1)));
+    maxLength = std::max(maxLength, i.second.size());
+  }
+  minLength = std::min(minLength, maxLength);
+
+  const size_t tableBits = std::min(maxLength, static_cast< size_t >(10));
+  std::vector< DecodeEntry > table(static_cast< size_t >(1) << tableBits);
+  for (size_t index = 0; index < table.size(); ++index)
+  {
+    HuffmanNode * curr = root_;
+    size_t length = 0;
+    while (length < tableBits)
+    {
+      curr = step(curr, ((index >> (tableBits - 1 - length)) & 1) ? '1' : '0');
+      ++length;
+      if (isLeaf(curr))
+      {
+        break;
+      }
+    }
+    table[index] = DecodeEntry{ curr, length };
+  }
+
+  size_t size = out.size();
+  out.resize(size + (last - first) / minLength);
+  char * dest = &out[0] + size;
+  const char * pos = first;
+  HuffmanNode * curr = root_;
+  while (pos != last)
+  {
+    if (curr == root_ && static_cast< size_t >(last - pos) >= tableBits)
+    {
+      size_t index = 0;
+      for (size_t i = 0; i < tableBits; ++i)
+      {
+        index = (index << 1) | (pos[i] == '1');
+      }
+      curr = table[index].node;
+      pos += table[index].length;
+    }
+    else
+    {
+      curr = step(curr, *pos);
+      ++pos;
+    }
+    if (isLeaf(curr))
+    {
+      *dest++ = curr->data;
+      curr = root_;
+    }
+  }
+  out.resize(dest - out.data());
+}
+
+void redko::HuffmanCode::makeDecodeTree()
+{
+  deleteTree(root_);
+  root_ = nullptr;
   root_ = new HuffmanNode();
 
   for (auto i : charsCode_)
@@ -81,39 +263,25 @@ void redko::HuffmanCode::decode()
     }
     curr->data = i.first;
   }
+}
 
-  HuffmanNode * curr = root_;
-  for (auto i : encodedText_)
+void redko::HuffmanCode::deleteTree(HuffmanNode * node)
+{
+  if (node)
   {
-    if (i == '0' && curr->left)
-    {
-      curr = curr->left;
-    }
-    else if (i == '1' && curr->right)
-    {
-      curr = curr->right;
-    }
-
-    if (!curr->left && !curr->right)
-    {
-      sourseText_ += curr->data;
-      curr = root_;
-    }
+    deleteTree(node->left);
+    deleteTree(node->right);
+    delete node;
   }
 }
 
-void redko::HuffmanCode::countFreq()
+void redko::HuffmanCode::countFreq(const unsigned long * freqs)
 {
-  for (auto i : sourseText_)
+  for (size_t i = 0; i < 256; ++i)
   {
-    auto it = charsFreq_.find(i);
-    if (it == charsFreq_.end())
+    if (freqs[i] != 0)
     {
-      charsFreq_.insert({ i, 1 });
-    }
-    else
-    {
-      ++(it->second);
+      charsFreq_.insert({ static_cast< char >(i), freqs[i] });
     }
   }
 }
@@ -139,6 +307,8 @@ void redko::HuffmanCode::makeCharCode(HuffmanNode * node, const std::string & st
 
 void redko::HuffmanCode::makeCodeTree()
 {
+  deleteTree(root_);
+  root_ = nullptr;
   redko::List< HuffmanNode * > nodes;
   HuffmanNode * tmp = nullptr;
   for (auto i : charsFreq_)
@@ -168,11 +338,117 @@ void redko::HuffmanCode::makeCodeTree()
   }
 }
 
+size_t redko::HuffmanCode::countBlocks() const
+{
+  const size_t minBlockSize = 1 << 20;
+  size_t threads = std::max(std::thread::hardware_concurrency(), 1u);
+  size_t blocks = sourseText_.size() / minBlockSize;
+  return std::max(std::min(blocks, threads), static_cast< size_t >(1));
+}
+
+template< typename F >
+void redko::HuffmanCode::forEachBlock(size_t blocks, F f) const
+{
+  size_t size = sourseText_.size();
+  std::vector< std::exception_ptr > errors(blocks);
+  auto run = [&f, &errors](size_t block, size_t first, size_t last)
+  {
+    try
+    {
+      f(block, first, last);
+    }
+    catch (...)
+    {
+      errors[block] = std::current_exception();
+    }
+  };
+
+  std::vector< std::thread > workers;
+  try
+  {
+    workers.reserve(blocks - 1);
+    for (size_t block = 1; block < blocks; ++block)
+    {
+      workers.emplace_back(run, block, size * block / blocks, size * (block + 1) / blocks);
+    }
+  }
+  catch (...)
+  {
+    for (auto && worker : workers)
+    {
+      worker.join();
+    }
+    throw;
+  }
+  run(0, 0, size / blocks);
+  for (auto && worker : workers)
+  {
+    worker.join();
+  }
+  for (auto && error : errors)
+  {
+    if (error)
+    {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
 bool redko::isBinary(const std::string & str)
 {
   return std::all_of(str.begin(), str.end(), [](char i){ return i == '0' || i == '1'; });
 }
 
+bool redko::isBinary(const char * first, const char * last)
+{
+  return std::all_of(first, last, [](char i){ return i == '0' || i == '1'; });
+}
+
+bool redko::readEncoded(const char * first, const char * last, EncodedSpan & dest)
+{
+  auto skipSpaces = [&](const char * pos)
+  {
+    return std::find_if(pos, last, [](char c){ return !std::isspace(static_cast< unsigned char >(c)); });
+  };
+  auto findSpace = [&](const char * pos)
+  {
+    return std::find_if(pos, last, [](char c){ return std::isspace(static_cast< unsigned char >(c)); });
+  };
+
+  const char * pos = skipSpaces(first);
+  const char * bitsEnd = findSpace(pos);
+  if (!isBinary(pos, bitsEnd))
+  {
+    return false;
+  }
+  BSTree< char, std::string > alphabet;
+  const char * curr = skipSpaces(bitsEnd);
+  while (curr != last)
+  {
+    const char * codeEnd = findSpace(curr);
+    std::string code(curr, codeEnd);
+    if (code == "end")
+    {
+      break;
+    }
+    if (!isBinary(curr, codeEnd))
+    {
+      return false;
+    }
+    curr = skipSpaces(codeEnd);
+    if (curr == last || *curr != ':' || ++curr == last)
+    {
+      return false;
+    }
+    alphabet.insert({ *curr, code });
+    curr = skipSpaces(curr + 1);
+  }
+  dest.first = pos;
+  dest.last = bitsEnd;
+  dest.alphabet = std::move(alphabet);
+  return true;
+}
+
 std::istream & redko::operator>>(std::istream & in, HuffmanCode & obj)
 {
   std::istream::sentry guard(in);
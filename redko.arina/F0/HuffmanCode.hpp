@@ -10,15 +10,25 @@ namespace redko
   public:
     HuffmanCode();
     explicit HuffmanCode(const std::string & src);
+    explicit HuffmanCode(std::string && src);
+    explicit HuffmanCode(const BSTree< char, std::string > & alph);
     HuffmanCode(const std::string & res, const BSTree< char, std::string > & alph);
+    HuffmanCode(const HuffmanCode & other) = delete;
+    HuffmanCode(HuffmanCode && other) noexcept;
+    ~HuffmanCode();
 
-    std::string getEncoded();
-    std::string getDecoded();
+    HuffmanCode & operator=(const HuffmanCode & other) = delete;
+    HuffmanCode & operator=(HuffmanCode && other) noexcept;
 
-    BSTree< char, std::string > getEncoding();
+    const std::string & getEncoded() const;
+    const std::string & getDecoded() const;
+
+    const BSTree< char, std::string > & getEncoding() const;
 
     void encode();
     void decode();
+    void decode(const char * first, const char * last);
+    void decode(const char * first, const char * last, std::string & out);
 
   private:
     struct HuffmanNode
@@ -41,9 +51,20 @@ namespace redko
       HuffmanNode * right;
     };
 
-    void countFreq();
+    struct DecodeEntry
+    {
+      HuffmanNode * node;
+      size_t length;
+    };
+
+    static void deleteTree(HuffmanNode * node);
+    void countFreq(const unsigned long * freqs);
     void makeCharCode(HuffmanNode * node, const std::string & str);
     void makeCodeTree();
+    void makeDecodeTree();
+    size_t countBlocks() const;
+    template< typename F >
+    void forEachBlock(size_t blocks, F f) const;
 
     BSTree< char, unsigned long > charsFreq_;
     BSTree< char, std::string > charsCode_;
@@ -52,7 +73,16 @@ namespace redko
     HuffmanNode * root_;
   };
 
+  struct EncodedSpan
+  {
+    const char * first;
+    const char * last;
+    BSTree< char, std::string > alphabet;
+  };
+
   bool isBinary(const std::string & str);
+  bool isBinary(const char * first, const char * last);
+  bool readEncoded(const char * first, const char * last, EncodedSpan & dest);
   std::istream & operator>>(std::istream & in, HuffmanCode & obj);
 }
 
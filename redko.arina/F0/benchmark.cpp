@@ -0,0 +1,170 @@
+#include "benchmark.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <new>
+#include <sstream>
+#include <dirent.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "HuffmanCode.hpp"
+#include "inputFunctions.hpp"
+#include "messageFunctions.hpp"
+
+namespace
+{
+  std::atomic< size_t > allocationsCount(0);
+}
+
+void * operator new(size_t size)
+{
+  ++allocationsCount;
+  void * ptr = std::malloc(size == 0 ? 1 : size);
+  if (!ptr)
+  {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, size_t) noexcept
+{
+  std::free(ptr);
+}
+
+size_t redko::getAllocationsCount()
+{
+  return allocationsCount;
+}
+
+size_t redko::getPeakMemory()
+{
+  rusage usage = {};
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss;
+}
+
+namespace
+{
+  void benchmarkFile(const std::string & file, size_t iterations)
+  {
+    using clock = std::chrono::steady_clock;
+    std::ifstream input(file, std::ios::binary);
+    std::ostringstream content;
+    content << input.rdbuf();
+    std::string source = content.str();
+    if (source.empty())
+    {
+      return;
+    }
+
+    double codeTime = 0.0;
+    double decodeTime = 0.0;
+    size_t encodedBits = 0;
+    bool ok = true;
+    size_t allocsBefore = redko::getAllocationsCount();
+    for (size_t i = 0; i < iterations; ++i)
+    {
+      auto start = clock::now();
+      redko::HuffmanCode coder(source);
+      coder.encode();
+      auto middle = clock::now();
+      redko::HuffmanCode decoder(coder.getEncoded(), coder.getEncoding());
+      decoder.decode();
+      auto finish = clock::now();
+
+      codeTime += std::chrono::duration< double >(middle - start).count();
+      decodeTime += std::chrono::duration< double >(finish - middle).count();
+      encodedBits = coder.getEncoded().size();
+      ok = ok && decoder.getDecoded() == source;
+    }
+    size_t allocs = (redko::getAllocationsCount() - allocsBefore) / iterations;
+
+    double megabytes = source.size() / 1048576.0;
+    codeTime /= iterations;
+    decodeTime /= iterations;
+    double codeSpeed = codeTime > 0.0 ? megabytes / codeTime : 0.0;
+    double decodeSpeed = decodeTime > 0.0 ? megabytes / decodeTime : 0.0;
+    std::cout << file << '\t' << source.size() << '\t' << iterations << '\t';
+    std::cout << std::fixed << std::setprecision(4) << encodedBits / (8.0 * source.size()) << '\t';
+    std::cout << std::setprecision(3) << codeTime * 1000 << '\t' << codeSpeed << '\t';
+    std::cout << decodeTime * 1000 << '\t' << decodeSpeed << '\t';
+    std::cout << allocs << '\t' << redko::getPeakMemory() << '\t' << (ok ? "yes" : "no") << '\n';
+    std::cout.unsetf(std::ios::floatfield);
+  }
+}
+
+void redko::benchmark(const std::string & descr)
+{
+  std::string d = descr;
+  std::string directory = cutName(d);
+  size_t iterations = 1;
+  try
+  {
+    if (!d.empty())
+    {
+      iterations = cutValue(d);
+    }
+  }
+  catch (const std::exception &)
+  {
+    printInvalidMessage(std::cout);
+    return;
+  }
+  if (directory.empty() || !d.empty() || iterations == 0)
+  {
+    printInvalidMessage(std::cout);
+    return;
+  }
+
+  DIR * dir = opendir(directory.c_str());
+  if (!dir)
+  {
+    printInvalidFile(std::cout);
+    return;
+  }
+  List< std::string > files;
+  while (dirent * entry = readdir(dir))
+  {
+    std::string path = directory + '/' + entry->d_name;
+    struct stat info = {};
+    if (stat(path.c_str(), &info) == 0 && S_ISREG(info.st_mode))
+    {
+      files.pushFront(path);
+    }
+  }
+  closedir(dir);
+  files.sort();
+
+  std::cout << "file\tbytes\titerations\tratio\tcode_ms\tcode_mbps\tdecode_ms\tdecode_mbps\tallocs\tpeak_rss_kb\tok\n";
+  for (auto && file : files)
+  {
+    // ru_maxrss never decreases, so each file runs in its own process to get its own peak
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+      benchmarkFile(file, iterations);
+      std::cout.flush();
+      _exit(0);
+    }
+    else if (pid > 0)
+    {
+      int status = 0;
+      waitpid(pid, &status, 0);
+    }
+    else
+    {
+      benchmarkFile(file, iterations);
+    }
+  }
+}
@@ -0,0 +1,13 @@
+#ifndef BENCHMARK_HPP
+#define BENCHMARK_HPP
+#include <cstddef>
+#include <string>
+
+namespace redko
+{
+  size_t getAllocationsCount();
+  size_t getPeakMemory();
+  void benchmark(const std::string & descr);
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include <functional>
 #include "userCommands.hpp"
+#include "benchmark.hpp"
 #include "inputFunctions.hpp"
 #include "messageFunctions.hpp"
 
@@ -14,6 +15,7 @@ int main()
   functions.insert({ "decode", redko::decode });
   functions.insert({ "recode", redko::recode });
   functions.insert({ "compare", redko::compare });
+  functions.insert({ "benchmark", redko::benchmark });
 
   std::string description = "";
   std::string command = "";
@@ -0,0 +1,61 @@
+#include "mappedFile.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+redko::MappedFile::MappedFile(const std::string & name):
+  data_(nullptr),
+  size_(0),
+  isOpen_(false)
+{
+  int fd = open(name.c_str(), O_RDONLY);
+  if (fd == -1)
+  {
+    return;
+  }
+  struct stat info = {};
+  if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+  {
+    size_ = info.st_size;
+    isOpen_ = true;
+    if (size_ != 0)
+    {
+      void * ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (ptr == MAP_FAILED)
+      {
+        size_ = 0;
+        isOpen_ = false;
+      }
+      else
+      {
+        data_ = static_cast< const char * >(ptr);
+        madvise(ptr, size_, MADV_SEQUENTIAL);
+      }
+    }
+  }
+  close(fd);
+}
+
+redko::MappedFile::~MappedFile()
+{
+  if (data_)
+  {
+    munmap(const_cast< char * >(data_), size_);
+  }
+}
+
+bool redko::MappedFile::isOpen() const
+{
+  return isOpen_;
+}
+
+const char * redko::MappedFile::begin() const
+{
+  return data_;
+}
+
+const char * redko::MappedFile::end() const
+{
+  return data_ + size_;
+}
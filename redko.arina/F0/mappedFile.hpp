@@ -0,0 +1,27 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+#include <string>
+
+namespace redko
+{
+  class MappedFile
+  {
+  public:
+    explicit MappedFile(const std::string & name);
+    MappedFile(const MappedFile &) = delete;
+    ~MappedFile();
+
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    bool isOpen() const;
+    const char * begin() const;
+    const char * end() const;
+
+  private:
+    const char * data_;
+    size_t size_;
+    bool isOpen_;
+  };
+}
+
+#endif
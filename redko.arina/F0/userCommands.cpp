@@ -3,6 +3,7 @@
 #include <iterator>
 #include <limits>
 #include "inputFunctions.hpp"
+#include "mappedFile.hpp"
 #include "messageFunctions.hpp"
 
 void redko::help(const std::string & descr)
@@ -37,6 +38,9 @@ void redko::help(const std::string & descr)
     std::cout << "      exit the program when there is nothing to work with\n";
     std::cout << "compare <filename1> <filename2>\n";
     std::cout << "      compare encodings of identical characters in files\n";
+    std::cout << "benchmark <directory> <iterations>\n";
+    std::cout << "      code and decode every file in the directory several times\n";
+    std::cout << "      print time, speed, memory and compression ratio as a tab-separated table\n";
   }
   else
   {
@@ -113,26 +117,26 @@ void redko::decode(const std::string & descr)
       printInvalidFormat(std::cout);
       return;
     }
+    obj.decode();
   }
   else
   {
-    std::ifstream input(descr);
-    if (!input)
+    MappedFile input(descr);
+    if (!input.isOpen())
     {
       printInvalidFile(std::cout);
       return;
     }
-    if (!(input >> obj) && !input.eof())
+    EncodedSpan encoded;
+    if (!readEncoded(input.begin(), input.end(), encoded))
     {
-      input.clear();
-      input.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
       printInvalidFormat(std::cout);
       return;
     }
+    obj = HuffmanCode(encoded.alphabet);
+    obj.decode(encoded.first, encoded.last);
   }
 
-  obj.decode();
-
   std::cout << "<succesfully decoded>\n";
 
   std::string description = "";
@@ -156,37 +160,27 @@ void redko::decode(const std::string & descr)
 void redko::recode(const std::string & descr)
 {
   std::string d = descr;
-  std::fstream firstInput(cutName(d));
-  std::fstream secondInput(cutName(d));
+  MappedFile firstInput(cutName(d));
+  MappedFile secondInput(cutName(d));
 
-  if (!firstInput || !secondInput)
+  if (!firstInput.isOpen() || !secondInput.isOpen())
   {
     printInvalidFile(std::cout);
     return;
   }
 
-  HuffmanCode firstObj;
-  if (!(firstInput >> firstObj) && !firstInput.eof())
+  EncodedSpan first;
+  EncodedSpan second;
+  if (!readEncoded(firstInput.begin(), firstInput.end(), first) || !readEncoded(secondInput.begin(), secondInput.end(), second))
   {
-    firstInput.clear();
-    firstInput.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
-    printInvalidFormat(std::cout);
-    return;
-  }
-  firstObj.decode();
-
-  HuffmanCode secondObj;
-  if (!(secondInput >> secondObj) && !secondInput.eof())
-  {
-    secondInput.clear();
-    secondInput.ignore(std::numeric_limits< std::streamsize >::max(), '\n');
     printInvalidFormat(std::cout);
     return;
   }
-  secondObj.decode();
 
-  std::string united = firstObj.getDecoded() + secondObj.getDecoded();
-  HuffmanCode result(united);
+  std::string united = "";
+  HuffmanCode(first.alphabet).decode(first.first, first.last, united);
+  HuffmanCode(second.alphabet).decode(second.first, second.last, united);
+  HuffmanCode result(std::move(united));
   result.encode();
 
   std::cout << "<succesfully recoded>\n";
@@ -209,7 +203,7 @@ void redko::recode(const std::string & descr)
   }
 }
 
-void redko::print(const std::string & command, HuffmanCode obj)
+void redko::print(const std::string & command, const HuffmanCode & obj)
 {
   if (command == "code")
   {
@@ -221,7 +215,7 @@ void redko::print(const std::string & command, HuffmanCode obj)
   }
 }
 
-void redko::save(const std::string & command, const std::string & descr, HuffmanCode obj)
+void redko::save(const std::string & command, const std::string & descr, const HuffmanCode & obj)
 {
   std::ofstream output(descr);
   if (!output)
@@ -233,8 +227,8 @@ void redko::save(const std::string & command, const std::string & descr, Huffman
   if (command == "code")
   {
     output << obj.getEncoded();
-    auto encoding = obj.getEncoding();
-    for (auto i : encoding)
+    const auto & encoding = obj.getEncoding();
+    for (auto && i : encoding)
     {
       output << '\n' << i.second << " :" << i.first;
     }
@@ -8,8 +8,8 @@ namespace redko
   void code(const std::string & descr);
   void decode(const std::string & descr);
   void recode(const std::string & descr);
-  void print(const std::string & command, HuffmanCode obj);
-  void save(const std::string & command, const std::string & descr, HuffmanCode obj);
+  void print(const std::string & command, const HuffmanCode & obj);
+  void save(const std::string & command, const std::string & descr, const HuffmanCode & obj);
   void compare(const std::string & descr);
 }
 
@@ -5,12 +5,12 @@
 #include <functional>
 #include <cmath>
 #include <cctype>
-#include "myMultiMap.hpp"
+#include "freqDict.hpp"
 #include "myMap.hpp"
 #include "myList.hpp"
 #include "utilsForDictsAndErrors.hpp"
 
-using mypair = std::pair< std::string, sobolevsky::MyMultiMap< size_t, std::string > >;
+using mypair = std::pair< std::string, sobolevsky::FreqDict >;
 
 void sobolevsky::getCommands(std::istream & in, std::ostream & out)
 {
@@ -30,11 +30,12 @@ void sobolevsky::getCommands(std::istream & in, std::ostream & out)
   out << "7.2.1.printDict -(n/all) - output a sorted list of a certain number of words without their frequency\n";
   out << "7.2.2.printDict -(n/all) -amount - output a sorted list of a certain number of words with their frequency\n";
   out << "7.3.unigueWords - outputs a list of unique words with no repetitions\n";
-  out << "7.4.wordCount - outputs the number of words in the text\n";
+  out << "7.4.1.wordCount - outputs the number of words in the text\n";
+  out << "7.4.2.wordCount < word > - outputs how many times the word occurs in the text\n";
   out << "7.5.save < filename > - saves the entire sorted frequency dictionary to a file\n";
 }
 
-void sobolevsky::getLoadAndCreate(std::shared_ptr< sobolevsky::List< mypair > > myVec, std::istream & in)
+void sobolevsky::getLoadAndCreate(std::shared_ptr< mydicts > myDicts, std::istream & in)
 {
   if (in.get() == '\n')
   {
@@ -44,7 +45,7 @@ void sobolevsky::getLoadAndCreate(std::shared_ptr< sobolevsky::List< mypair > >
   std::string file;
   in >> file;
   std::ifstream text(file);
-  if (!text)
+  if (!text || myDicts->find(file) != myDicts->end())
   {
     errorInpName(std::cerr);
     return;
@@ -81,15 +82,15 @@ void sobolevsky::getLoadAndCreate(std::shared_ptr< sobolevsky::List< mypair > >
     }
   }
 
-  MyMultiMap< size_t, std::string > myMultiMap;
+  FreqDict dict;
   for (std::pair< std::string, size_t > const &pair : myMap)
   {
-    myMultiMap.insert(std::make_pair(pair.second, pair.first));
+    dict.insert(pair.first, pair.second);
   }
-  myVec->pushBack(std::pair< std::string, MyMultiMap<size_t, std::string> >(file, myMultiMap));
+  (*myDicts)[file].swap(dict);
 }
 
-void sobolevsky::getDelete(std::shared_ptr< sobolevsky::List< mypair > > myVec, std::istream & in)
+void sobolevsky::getDelete(std::shared_ptr< mydicts > myDicts, std::istream & in)
 {
   if (in.get() == '\n')
   {
@@ -102,20 +103,17 @@ void sobolevsky::getDelete(std::shared_ptr< sobolevsky::List< mypair > > myVec,
   {
     error(std::cerr);
   }
-  if (findIf(myVec->begin(), myVec->end(), name) == myVec->end())
+  if (myDicts->find(name) == myDicts->end())
   {
     errorInpName(std::cerr);
     return;
   }
-  else
-  {
-    myVec->erase(findIf(myVec->begin(), myVec->end(), name));
-  }
+  myDicts->erase(name);
 }
 
-void sobolevsky::getAllDicts(std::shared_ptr< sobolevsky::List< mypair > > myVec,std::istream & in, std::ostream & out)
+void sobolevsky::getAllDicts(std::shared_ptr< mydicts > myDicts,std::istream & in, std::ostream & out)
 {
-  if (myVec->size() == 0)
+  if (myDicts->empty())
   {
     errorInpName(std::cerr);
     return;
@@ -127,13 +125,13 @@ void sobolevsky::getAllDicts(std::shared_ptr< sobolevsky::List< mypair > > myVec
     return;
   }
 
-  for (mypair &pair : *myVec)
+  for (mypair &pair : *myDicts)
   {
     out << pair.first << "\n";
   }
 }
 
-void sobolevsky::getRename(std::shared_ptr< sobolevsky::List< mypair > > myVec, std::istream & in)
+void sobolevsky::getRename(std::shared_ptr< mydicts > myDicts, std::istream & in)
 {
   if (in.get() == '\n')
   {
@@ -142,10 +140,13 @@ void sobolevsky::getRename(std::shared_ptr< sobolevsky::List< mypair > > myVec,
   }
   std::string oldName, newName;
   in >> oldName >> newName;
-  if(findIf(myVec->begin(), myVec->end(), oldName) != myVec->end() &&
-  findIf(myVec->begin(), myVec->end(), newName) == myVec->end())
+  mydicts::Iterator iter = myDicts->find(oldName);
+  if (iter != myDicts->end() && myDicts->find(newName) == myDicts->end())
   {
-    findIf(myVec->begin(), myVec->end(), oldName)->first = newName;
+    FreqDict dict;
+    dict.swap(iter->second);
+    myDicts->erase(oldName);
+    (*myDicts)[newName].swap(dict);
   }
   else
   {
@@ -159,92 +160,40 @@ void sobolevsky::getRename(std::shared_ptr< sobolevsky::List< mypair > > myVec,
   }
 }
 
-void sobolevsky::getCompareDicts(std::shared_ptr< sobolevsky::List< mypair > > myVec, std::istream & in, std::ostream & out)
+void sobolevsky::getCompareDicts(std::shared_ptr< mydicts > myDicts, std::istream & in, std::ostream & out)
 {
   if (in.get() == '\n')
   {
     error(std::cerr);
     return;
   }
-  if (myVec->size() < 2)
+  if (myDicts->size() < 2)
   {
     errorInpName(std::cerr);
     return;
   }
   std::string name1, name2;
   in >> name1 >> name2;
-  if(findIf(myVec->begin(), myVec->end(), name1) != myVec->end() &&
-  findIf(myVec->begin(), myVec->end(), name2) != myVec->end())
+  mydicts::Iterator iter1 = myDicts->find(name1);
+  mydicts::Iterator iter2 = myDicts->find(name2);
+  if (iter1 != myDicts->end() && iter2 != myDicts->end())
   {
-    mypair pair1(*findIf(myVec->begin(), myVec->end(), name1));
-    mypair pair2(*findIf(myVec->begin(), myVec->end(), name2));
-    MyMap< std::string, size_t > allwords;
-    for (typename MyMultiMap< size_t, std::string >::Iterator iter = pair1.second.begin(); iter != pair1.second.end(); iter++)
-    {
-      if (iter->size() == 1)
-      {
-        allwords.insert(std::make_pair((*iter)[0], 0));
-      }
-      else
-      {
-        for (size_t i = 0; i < iter->size(); i++)
-        {
-          allwords.insert(std::make_pair((*iter)[i], 0));
-        }
-      }
-    }
-    for (typename MyMultiMap< size_t, std::string >::Iterator iter = pair2.second.begin(); iter != pair2.second.end(); iter++)
-    {
-      if (iter->size() == 1)
-      {
-        allwords.insert(std::make_pair((*iter)[0], 0));
-      }
-      else
-      {
-        for (size_t i = 0; i < iter->size(); i++)
-        {
-          allwords.insert(std::make_pair((*iter)[i], 0));
-        }
-      }
-    }
-    MyMap< std::string, size_t > vec1(allwords);
-    MyMap< std::string, size_t > vec2(allwords);
-    for (typename MyMultiMap< size_t, std::string >::Iterator iter = pair1.second.begin(); iter != pair1.second.end(); iter++)
-    {
-      if (iter->size() == 1)
-      {
-        vec1.find((*iter)[0])->second++;
-      }
-      else
-      {
-        for (size_t i = 0; i < iter->size(); i++)
-        {
-          vec1.find((*iter)[i])->second++;
-        }
-      }
-    }
-    for (typename MyMultiMap< size_t, std::string >::Iterator iter = pair2.second.begin(); iter != pair2.second.end(); iter++)
+    FreqDict &dict1 = iter1->second;
+    FreqDict &dict2 = iter2->second;
+    size_t productOfVecs = 0;
+    size_t vecLenght1 = 0;
+    size_t vecLenght2 = 0;
+    for (FreqDict::freqs_t::Iterator iter = dict1.getFreqs().begin(); iter != dict1.getFreqs().end(); iter++)
     {
-      if (iter->size() == 1)
-      {
-        vec2.find((*iter)[0])->second++;
-      }
-      else
+      for (const std::string &word : *iter)
       {
-        for (size_t i = 0; i < iter->size(); i++)
-        {
-          vec2.find((*iter)[i])->second++;
-        }
+        productOfVecs += iter.getKey() * dict2.count(word);
+        vecLenght1 += iter.getKey() * iter.getKey();
       }
     }
-    size_t productOfVecs = 0;
-    size_t vecLenght1 = 0;
-    size_t vecLenght2 = 0;
-    for (std::pair< std::string, size_t > const &pair : allwords)
+    for (FreqDict::freqs_t::Iterator iter = dict2.getFreqs().begin(); iter != dict2.getFreqs().end(); iter++)
     {
-      productOfVecs += (vec1.at(pair.first) * vec2.at(pair.first));
-      vecLenght1 += vec1.at(pair.first) * vec1.at(pair.first);
-      vecLenght2 += vec2.at(pair.first) * vec2.at(pair.first);
+      vecLenght2 += iter->size() * iter.getKey() * iter.getKey();
     }
     out << "similarity coefficient of two dictionaries: " << productOfVecs/(std::sqrt(vecLenght1) * std::sqrt(vecLenght2)) << "\n";
   }
@@ -337,27 +286,34 @@ void sobolevsky::uniqeWords(mypair &myPair, std::istream & in, std::ostream & ou
     error(std::cerr);
     return;
   }
-  for (MyMultiMap< size_t, std::string >::Iterator iter = myPair.second.begin(); iter != myPair.second.end(); iter++)
+  FreqDict::freqs_t::Iterator iter = myPair.second.getFreqs().find(1);
+  if (iter == myPair.second.getFreqs().end())
   {
-    if (iter->size() == 1)
-    {
-      out << (*iter)[0] << "\n";
-    }
-    else
-    {
-      break;
-    }
+    return;
+  }
+  for (const std::string &word : *iter)
+  {
+    out << word << "\n";
   }
 }
 
 void sobolevsky::wordCount(mypair &myPair, std::istream & in, std::ostream & out)
 {
+  if (in.get() == '\n')
+  {
+    out << myPair.second.size() << "\n";
+    return;
+  }
+  std::string word;
+  in >> word;
   if (in.get() != '\n')
   {
     error(std::cerr);
     return;
   }
-  out << myPair.second.size() << "\n";
+  std::transform(word.begin(), word.end(), word.begin(), charCheck);
+  word.erase(remove(word.begin(), word.end(), 0), word.end());
+  out << myPair.second.count(word) << "\n";
 }
 
 void sobolevsky::save(mypair &myPair, std::istream &in)
@@ -383,7 +339,7 @@ void sobolevsky::save(mypair &myPair, std::istream &in)
   dictOutput(myPair, file, myPair.second.size(), true);
 }
 
-void sobolevsky::getSelect(std::shared_ptr< sobolevsky::List< mypair > > myVec, std::istream & in, std::ostream & out)
+void sobolevsky::getSelect(std::shared_ptr< mydicts > myDicts, std::istream & in, std::ostream & out)
 {
   if (in.get() == '\n')
   {
@@ -392,12 +348,13 @@ void sobolevsky::getSelect(std::shared_ptr< sobolevsky::List< mypair > > myVec,
   }
   std::string name;
   in >> name;
-  if (findIf(myVec->begin(), myVec->end(), name) == myVec->end())
+  mydicts::Iterator iter = myDicts->find(name);
+  if (iter == myDicts->end())
   {
     errorInpName(std::cerr);
     return;
   }
-  mypair currPair(*findIf(myVec->begin(), myVec->end(), name));
+  mypair &currPair = *iter;
   std::map< std::string, std::function< void(mypair &, std::istream &, std::ostream &) > > commands;
   commands["holyTrinity"] = holyTrinity;
   commands["printDict"] = printDict;
@@ -0,0 +1,94 @@
+#include "freqDict.hpp"
+
+sobolevsky::FreqDict::FreqDict(const FreqDict &rhs):
+  words_(rhs.words_),
+  freqs_(rhs.freqs_)
+{
+  relink();
+}
+
+sobolevsky::FreqDict &sobolevsky::FreqDict::operator=(const FreqDict &rhs)
+{
+  if (this != &rhs)
+  {
+    FreqDict temp(rhs);
+    swap(temp);
+  }
+  return *this;
+}
+
+void sobolevsky::FreqDict::insert(const std::string &word, size_t amount)
+{
+  if (amount == 0)
+  {
+    return;
+  }
+  MyMap< std::string, Entry >::Iterator iter = words_.find(word);
+  if (iter == words_.end())
+  {
+    List< std::string >::Iterator position = freqs_.insert(std::make_pair(amount, word));
+    words_.insert(std::make_pair(word, Entry{ amount, position }));
+  }
+  else
+  {
+    Entry &entry = iter->second;
+    freqs_.erase(entry.freq, entry.position);
+    entry.freq += amount;
+    entry.position = freqs_.insert(std::make_pair(entry.freq, word));
+  }
+}
+
+void sobolevsky::FreqDict::erase(const std::string &word)
+{
+  MyMap< std::string, Entry >::Iterator iter = words_.find(word);
+  if (iter == words_.end())
+  {
+    return;
+  }
+  freqs_.erase(iter->second.freq, iter->second.position);
+  words_.erase(word);
+}
+
+void sobolevsky::FreqDict::clear()
+{
+  words_.clear();
+  freqs_.clear();
+}
+
+void sobolevsky::FreqDict::swap(FreqDict &rhs) noexcept
+{
+  words_.swap(rhs.words_);
+  freqs_.swap(rhs.freqs_);
+}
+
+size_t sobolevsky::FreqDict::count(const std::string &word)
+{
+  MyMap< std::string, Entry >::Iterator iter = words_.find(word);
+  return iter == words_.end() ? 0 : iter->second.freq;
+}
+
+size_t sobolevsky::FreqDict::size()
+{
+  return words_.size();
+}
+
+bool sobolevsky::FreqDict::empty()
+{
+  return words_.empty();
+}
+
+sobolevsky::FreqDict::freqs_t &sobolevsky::FreqDict::getFreqs()
+{
+  return freqs_;
+}
+
+void sobolevsky::FreqDict::relink()
+{
+  for (freqs_t::Iterator iter = freqs_.begin(); iter != freqs_.end(); iter++)
+  {
+    for (List< std::string >::Iterator word = iter->begin(); word != iter->end(); word++)
+    {
+      words_.find(*word)->second.position = word;
+    }
+  }
+}
@@ -0,0 +1,48 @@
+#ifndef FREQDICT_HPP
+#define FREQDICT_HPP
+
+#include <string>
+#include "myList.hpp"
+#include "myMap.hpp"
+#include "myMultiMap.hpp"
+
+namespace sobolevsky
+{
+  class FreqDict
+  {
+  public:
+    using freqs_t = MyMultiMap< size_t, std::string >;
+
+    FreqDict() = default;
+    FreqDict(const FreqDict &rhs);
+    FreqDict(FreqDict &&rhs) noexcept = default;
+    ~FreqDict() = default;
+
+    FreqDict &operator=(const FreqDict &rhs);
+    FreqDict &operator=(FreqDict &&rhs) noexcept = default;
+
+    void insert(const std::string &word, size_t amount = 1);
+    void erase(const std::string &word);
+    void clear();
+    void swap(FreqDict &rhs) noexcept;
+
+    size_t count(const std::string &word);
+    size_t size();
+    bool empty();
+
+    freqs_t &getFreqs();
+  private:
+    struct Entry
+    {
+      size_t freq;
+      List< std::string >::Iterator position;
+    };
+
+    MyMap< std::string, Entry > words_;
+    freqs_t freqs_;
+
+    void relink();
+  };
+}
+
+#endif
@@ -7,15 +7,14 @@
 #include <functional>
 #include "commands.hpp"
 #include "myMap.hpp"
-#include "myMultiMap.hpp"
+#include "freqDict.hpp"
 #include "myList.hpp"
 #include "utilsForDictsAndErrors.hpp"
 
 int main()
 {
   std::cout << "To view the available commands, type \"commands\"\n";
-  std::shared_ptr< sobolevsky::List< std::pair< std::string, sobolevsky::MyMultiMap< size_t, std::string > > > > myContainer
-  (new sobolevsky::List< std::pair<std::string, sobolevsky::MyMultiMap< size_t, std::string > > >());
+  std::shared_ptr< mydicts > myContainer(new mydicts());
 
   sobolevsky::MyMap< std::string, std::function< void(std::istream & in, std::ostream & out) > > cmds;
 
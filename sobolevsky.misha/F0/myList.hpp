@@ -2,6 +2,7 @@
 #define MYLIST_HPP
 
 #include <iostream>
+#include <utility>
 
 namespace sobolevsky
 {
@@ -15,8 +16,13 @@ namespace sobolevsky
 
     List();
     List(const T &val);
+    List(const List &rhs);
+    List(List &&rhs) noexcept;
     ~List();
 
+    List &operator=(const List &rhs);
+    List &operator=(List &&rhs) noexcept;
+
     void pushFront(const T &data);
     void pushBack(const T &data);
     void popFront();
@@ -25,12 +31,14 @@ namespace sobolevsky
     void remove(T val);
     void erase(Iterator position);
     void assign(size_t n, const T & val);
+    void swap(List &rhs) noexcept;
     bool empty();
     size_t size();
     Node *getAt(size_t index);
     T operator[](size_t index);
     Iterator begin() noexcept;
     Iterator end() noexcept;
+    Iterator rbegin() noexcept;
   private:
     Node *head;
     Node *tail;
@@ -59,6 +67,7 @@ sobolevsky::List< T >::List()
 {
   head = nullptr;
   tail = nullptr;
+  size_ = 0;
 }
 
 template< typename T >
@@ -67,6 +76,24 @@ sobolevsky::List< T >::List(const T &val)
   Node *ptr = new Node(val);
   head = ptr;
   tail = ptr;
+  size_ = 1;
+}
+
+template< typename T >
+sobolevsky::List< T >::List(const List &rhs):
+  List()
+{
+  for (Node *ptr = rhs.head; ptr != nullptr; ptr = ptr->next)
+  {
+    pushBack(ptr->data_);
+  }
+}
+
+template< typename T >
+sobolevsky::List< T >::List(List &&rhs) noexcept:
+  List()
+{
+  swap(rhs);
 }
 
 template< typename T >
@@ -75,6 +102,28 @@ sobolevsky::List< T >::~List()
   clear();
 }
 
+template< typename T >
+sobolevsky::List< T > &sobolevsky::List< T >::operator=(const List &rhs)
+{
+  if (this != &rhs)
+  {
+    List temp(rhs);
+    swap(temp);
+  }
+  return *this;
+}
+
+template< typename T >
+sobolevsky::List< T > &sobolevsky::List< T >::operator=(List &&rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    List temp(std::move(rhs));
+    swap(temp);
+  }
+  return *this;
+}
+
 template< typename T >
 void sobolevsky::List< T >::pushFront(const T &data)
 {
@@ -168,53 +217,39 @@ template< typename T >
 void sobolevsky::List< T >::remove(T val)
 {
   Node *ptr = head;
-  Node *tempPtr = nullptr;
   while (ptr != nullptr)
   {
-    tempPtr = ptr->next;
+    Node *tempPtr = ptr->next;
     if (ptr->data_ == val)
     {
-      if (ptr->prev == nullptr)
-      {
-        ptr->next->prev = ptr->prev;
-        delete ptr;
-      }
-      else if (ptr->next == nullptr)
-      {
-        ptr->prev->next = ptr->next;
-        delete ptr;
-      }
-      else
-      {
-        ptr->prev->next = ptr->next;
-        ptr->next->prev = ptr->prev;
-        delete ptr;
-      }
+      erase(Iterator(ptr));
     }
     ptr = tempPtr;
-    size_--;
   }
 }
 
 template< typename T >
 void sobolevsky::List< T >::erase(Iterator position)
 {
-  if (position.getNode()->prev == nullptr)
+  Node *ptr = position.getNode();
+  if (ptr->prev == nullptr)
+  {
+    head = ptr->next;
+  }
+  else
   {
-    position.getNode()->next->prev = position.getNode()->prev;
-    delete position.getNode();
+    ptr->prev->next = ptr->next;
   }
-  else if (position.getNode()->next == nullptr)
+  if (ptr->next == nullptr)
   {
-    position.getNode()->prev->next = position.getNode()->next;
-    delete position.getNode();
+    tail = ptr->prev;
   }
   else
   {
-    position.getNode()->prev->next = position.getNode()->next;
-    position.getNode()->next->prev = position.getNode()->prev;
-    delete position.getNode();
+    ptr->next->prev = ptr->prev;
   }
+  delete ptr;
+  size_--;
 }
 
 template< typename T >
@@ -227,6 +262,14 @@ void sobolevsky::List< T >::assign(size_t n, const T & val)
   }
 }
 
+template< typename T >
+void sobolevsky::List< T >::swap(List &rhs) noexcept
+{
+  std::swap(head, rhs.head);
+  std::swap(tail, rhs.tail);
+  std::swap(size_, rhs.size_);
+}
+
 template< typename T >
 bool sobolevsky::List< T >::empty()
 {
@@ -276,6 +319,12 @@ typename sobolevsky::List< T >::Iterator sobolevsky::List< T >::end() noexcept
   return Iterator(nullptr);
 }
 
+template< typename T >
+typename sobolevsky::List< T >::Iterator sobolevsky::List< T >::rbegin() noexcept
+{
+  return Iterator(tail);
+}
+
 template< typename T >
 class sobolevsky::List< T >::Iterator
 {
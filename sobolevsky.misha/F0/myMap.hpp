@@ -18,7 +18,10 @@ namespace sobolevsky
     MyMap();
     MyMap(const MyMap< Key, Value > &tree);
     MyMap(MyMap< Key, Value > &&rhs) noexcept;
-    ~MyMap() = default;
+    ~MyMap();
+
+    MyMap &operator=(const MyMap< Key, Value > &rhs);
+    MyMap &operator=(MyMap< Key, Value > &&rhs) noexcept;
 
     Iterator begin() noexcept;
     Iterator end() noexcept;
@@ -48,9 +51,12 @@ namespace sobolevsky
     Node *LeftRotate(Node *node_);
     Node *LeftRightRotate(Node *node_);
     Node *RightLeftRotate(Node *node_);
+    Node *balance(Node *node_);
     Node *delet(const Key &key, Node *node_);
+    Node *removeMin(Node *node_, Node *&min);
     size_t height(Node *node_);
     void recurionDeleteAll(Node *node);
+    Node *copy(const Node *node, Node *parent);
 
     Node *root;
     size_t size_;
@@ -87,7 +93,7 @@ sobolevsky::MyMap< Key, Value >::MyMap()
 template< typename Key, typename Value >
 sobolevsky::MyMap< Key, Value >::MyMap(const MyMap< Key, Value > &tree)
 {
-  root = tree.root;
+  root = copy(tree.root, nullptr);
   size_ = tree.size_;
 }
 
@@ -95,7 +101,61 @@ template< typename Key, typename Value >
 sobolevsky::MyMap< Key, Value >::MyMap(MyMap< Key, Value > &&rhs) noexcept
 {
   root = rhs.root;
-  size_ = std::move(rhs.size_);
+  size_ = rhs.size_;
+  rhs.root = nullptr;
+  rhs.size_ = 0;
+}
+
+template< typename Key, typename Value >
+sobolevsky::MyMap< Key, Value >::~MyMap()
+{
+  clear();
+}
+
+template< typename Key, typename Value >
+sobolevsky::MyMap< Key, Value > &sobolevsky::MyMap< Key, Value >::operator=(const MyMap< Key, Value > &rhs)
+{
+  if (this != &rhs)
+  {
+    MyMap< Key, Value > temp(rhs);
+    swap(temp);
+  }
+  return *this;
+}
+
+template< typename Key, typename Value >
+sobolevsky::MyMap< Key, Value > &sobolevsky::MyMap< Key, Value >::operator=(MyMap< Key, Value > &&rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    MyMap< Key, Value > temp(std::move(rhs));
+    swap(temp);
+  }
+  return *this;
+}
+
+template< typename Key, typename Value >
+typename sobolevsky::MyMap< Key, Value >::Node *sobolevsky::MyMap< Key, Value >::copy(const Node *node, Node *parent)
+{
+  if (node == nullptr)
+  {
+    return nullptr;
+  }
+  Node *result = new Node(*node);
+  result->parent = parent;
+  result->left = nullptr;
+  result->right = nullptr;
+  try
+  {
+    result->left = copy(node->left, result);
+    result->right = copy(node->right, result);
+  }
+  catch (...)
+  {
+    recurionDeleteAll(result);
+    throw;
+  }
+  return result;
 }
 
 template< typename Key, typename Value >
@@ -138,7 +198,12 @@ Value &sobolevsky::MyMap< Key, Value >::at(const Key &key)
 template< typename Key, typename Value >
 void sobolevsky::MyMap< Key, Value >::insert(const std::pair< Key, Value > &pair)
 {
+  if (find(pair.first) != end())
+  {
+    return;
+  }
   root = push(pair.first, pair.second, root);
+  root->parent = nullptr;
   size_++;
 }
 
@@ -148,41 +213,40 @@ typename sobolevsky::MyMap< Key, Value >::Node *sobolevsky::MyMap< Key, Value >:
 {
   if (node_ == nullptr)
   {
-    node_ = new Node(key, value);
+    return new Node(key, value);
   }
   else if (key < node_->data.first)
   {
     node_->left = push(key, value, node_->left);
     node_->left->parent = node_;
-    node_->height++;
-    if (height(node_->left) - height(node_->right) > 1)
-    {
-      if (node_->right == nullptr || key < node_->left->data.first)
-      {
-        node_ = RightRotate(node_);
-      }
-      else
-      {
-        node_ = LeftRightRotate(node_);
-      }
-    }
   }
-  else if (key > node_->data.first)
+  else
   {
     node_->right = push(key, value, node_->right);
     node_->right->parent = node_;
-    node_->height++;
-    if ((height(node_->right) - height(node_->left)) > 1)
+  }
+  return balance(node_);
+}
+
+template< typename Key, typename Value >
+typename sobolevsky::MyMap< Key, Value >::Node *sobolevsky::MyMap< Key, Value >::balance(Node *node_)
+{
+  node_->height = std::max(height(node_->left), height(node_->right)) + 1;
+  if (height(node_->left) > height(node_->right) + 1)
+  {
+    if (height(node_->left->left) >= height(node_->left->right))
     {
-      if (node_->left == nullptr || key > node_->right->data.first)
-      {
-        node_ = LeftRotate(node_);
-      }
-      else
-      {
-        node_ = RightLeftRotate(node_);
-      }
+      return RightRotate(node_);
+    }
+    return LeftRightRotate(node_);
+  }
+  if (height(node_->right) > height(node_->left) + 1)
+  {
+    if (height(node_->right->right) >= height(node_->right->left))
+    {
+      return LeftRotate(node_);
     }
+    return RightLeftRotate(node_);
   }
   return node_;
 }
@@ -239,15 +303,22 @@ typename sobolevsky::MyMap< Key, Value >::Node *sobolevsky::MyMap< Key, Value >:
 template< typename Key, typename Value >
 void sobolevsky::MyMap< Key, Value >::erase(const Key &key)
 {
+  if (find(key) == end())
+  {
+    return;
+  }
   root = delet(key, root);
+  if (root != nullptr)
+  {
+    root->parent = nullptr;
+  }
   size_--;
 }
 
 template< typename Key, typename Value >
 void sobolevsky::MyMap< Key, Value >::erase(ConstIterator position)
 {
-  root = delet(position->data.first, root);
-  size_--;
+  erase(position->first);
 }
 
 template< typename Key, typename Value >
@@ -260,64 +331,65 @@ typename sobolevsky::MyMap< Key, Value >::Node *sobolevsky::MyMap< Key, Value >:
   else if (key < node_->data.first)
   {
     node_->left = delet(key, node_->left);
+    if (node_->left != nullptr)
+    {
+      node_->left->parent = node_;
+    }
   }
   else if (key > node_->data.first)
   {
     node_->right = delet(key, node_->right);
+    if (node_->right != nullptr)
+    {
+      node_->right->parent = node_;
+    }
   }
   else if (node_->left && node_->right)
   {
-    Node *temp = node_->right;
-    while (temp->left != nullptr)
+    Node *temp = nullptr;
+    Node *right = removeMin(node_->right, temp);
+    temp->left = node_->left;
+    temp->left->parent = temp;
+    temp->right = right;
+    if (right != nullptr)
     {
-      temp = temp->left;
+      right->parent = temp;
     }
-    node_->data = temp->data;
-    node_->right = delet(node_->data.first, node_->right);
+    temp->parent = node_->parent;
+    delete node_;
+    return balance(temp);
   }
   else
   {
-    Node *temp = node_;
-    if (node_->left == nullptr)
+    Node *temp = (node_->left == nullptr) ? node_->right : node_->left;
+    if (temp != nullptr)
     {
-      node_ = node_->right;
+      temp->parent = node_->parent;
     }
-    else if (node_->right== nullptr)
-    {
-      node_ = node_->left;
-    }
-  }
-
-  if (node_ == nullptr)
-  {
-    return nullptr;
+    delete node_;
+    return temp;
   }
+  return balance(node_);
+}
 
-  node_->height = std::max(height(node_->left), height(node_->right)) + 1;
-
-  if (height(node_->left) - height(node_->right) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+template< typename Key, typename Value >
+typename sobolevsky::MyMap< Key, Value >::Node *sobolevsky::MyMap< Key, Value >::removeMin(Node *node_, Node *&min)
+{
+  if (node_->left == nullptr)
   {
-    if (height(node_->left->left) - height(node_->left->right) > 0)
+    min = node_;
+    if (node_->right != nullptr)
     {
-      return LeftRotate(node_);
-    }
-    else if (node_->right != nullptr)
-    {
-      return RightLeftRotate(node_);
+      node_->right->parent = node_->parent;
     }
+    return node_->right;
   }
-  else if (height(node_->right) - height(node_->left) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+  node_->left = removeMin(node_->left, min);
+  if (node_->left != nullptr)
   {
-    if (height(node_->right->right) - height(node_->right->left) > 0)
-    {
-      return RightRotate(node_);
-    }
-    else if (node_->left != nullptr)
-    {
-      return LeftRightRotate(node_);
-    }
+    node_->left->parent = node_;
   }
-  return node_;
+  return balance(node_);
 }
 
 template< typename Key, typename Value >
@@ -547,7 +619,7 @@ template< typename Key, typename Value >
 typename sobolevsky::MyMap< Key, Value >::Iterator sobolevsky::MyMap< Key, Value >::begin() noexcept
 {
   Node *temp = root;
-  while (temp->left != nullptr)
+  while (temp != nullptr && temp->left != nullptr)
   {
     temp = temp->left;
   }
@@ -564,7 +636,7 @@ template< typename Key, typename Value >
 typename sobolevsky::MyMap< Key, Value >::ConstIterator sobolevsky::MyMap< Key, Value >::cbegin() const noexcept
 {
   Node *temp = root;
-  while (temp->left != nullptr)
+  while (temp != nullptr && temp->left != nullptr)
   {
     temp = temp->left;
   }
@@ -653,7 +725,7 @@ template< typename Key, typename Value >
 typename sobolevsky::MyMap< Key, Value >::ConstIterator &sobolevsky::MyMap< Key, Value >::ConstIterator::operator=
 (ConstIterator &&rhs)
 {
-  node_(rhs.node_);
+  node_ = rhs.node_;
   return *this;
 }
 
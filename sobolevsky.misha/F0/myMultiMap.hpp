@@ -19,7 +19,10 @@ namespace sobolevsky
     MyMultiMap();
     MyMultiMap(const MyMultiMap< Key, Value > &tree);
     MyMultiMap(MyMultiMap< Key, Value > &&rhs) noexcept;
-    ~MyMultiMap() = default;
+    ~MyMultiMap();
+
+    MyMultiMap &operator=(const MyMultiMap< Key, Value > &rhs);
+    MyMultiMap &operator=(MyMultiMap< Key, Value > &&rhs) noexcept;
 
     Iterator begin() noexcept;
     Iterator end() noexcept;
@@ -33,8 +36,9 @@ namespace sobolevsky
     List< Value > &operator[](const Key &key);
     List< Value > &at(const Key &key);
 
-    void insert(const std::pair< Key, Value > &pair);
+    typename List< Value >::Iterator insert(const std::pair< Key, Value > &pair);
     void erase(const Key &key);
+    void erase(const Key &key, typename List< Value >::Iterator position);
     void erase(ConstIterator position);
     void clear();
     void swap(MyMultiMap &x);
@@ -49,9 +53,11 @@ namespace sobolevsky
     Node *LeftRotate(Node *node_);
     Node *LeftRightRotate(Node *node_);
     Node *RightLeftRotate(Node *node_);
+    Node *balance(Node *node_);
     Node *delet(const Key &key, Node *node_);
     size_t height(Node *node_);
     void recurionDeleteAll(Node *node);
+    Node *copy(const Node *node, Node *parent);
 
     Node *root;
     size_t size_;
@@ -91,7 +97,7 @@ sobolevsky::MyMultiMap< Key, Value >::MyMultiMap()
 template< typename Key, typename Value >
 sobolevsky::MyMultiMap< Key, Value >::MyMultiMap(const MyMultiMap< Key, Value > &tree)
 {
-  root = tree.root;
+  root = copy(tree.root, nullptr);
   size_ = tree.size_;
 }
 
@@ -99,7 +105,61 @@ template< typename Key, typename Value >
 sobolevsky::MyMultiMap< Key, Value >::MyMultiMap(MyMultiMap< Key, Value > &&rhs) noexcept
 {
   root = rhs.root;
-  size_ = std::move(rhs.size_);
+  size_ = rhs.size_;
+  rhs.root = nullptr;
+  rhs.size_ = 0;
+}
+
+template< typename Key, typename Value >
+sobolevsky::MyMultiMap< Key, Value >::~MyMultiMap()
+{
+  clear();
+}
+
+template< typename Key, typename Value >
+sobolevsky::MyMultiMap< Key, Value > &sobolevsky::MyMultiMap< Key, Value >::operator=(const MyMultiMap< Key, Value > &rhs)
+{
+  if (this != &rhs)
+  {
+    MyMultiMap< Key, Value > temp(rhs);
+    swap(temp);
+  }
+  return *this;
+}
+
+template< typename Key, typename Value >
+sobolevsky::MyMultiMap< Key, Value > &sobolevsky::MyMultiMap< Key, Value >::operator=(MyMultiMap< Key, Value > &&rhs) noexcept
+{
+  if (this != &rhs)
+  {
+    MyMultiMap< Key, Value > temp(std::move(rhs));
+    swap(temp);
+  }
+  return *this;
+}
+
+template< typename Key, typename Value >
+typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key, Value >::copy(const Node *node, Node *parent)
+{
+  if (node == nullptr)
+  {
+    return nullptr;
+  }
+  Node *result = new Node(*node);
+  result->parent = parent;
+  result->left = nullptr;
+  result->right = nullptr;
+  try
+  {
+    result->left = copy(node->left, result);
+    result->right = copy(node->right, result);
+  }
+  catch (...)
+  {
+    recurionDeleteAll(result);
+    throw;
+  }
+  return result;
 }
 
 template< typename Key, typename Value >
@@ -135,23 +195,26 @@ typename sobolevsky::List< Value > &sobolevsky::MyMultiMap< Key, Value >::at(con
   }
   else
   {
-    return (find(key));
+    return *find(key);
   }
 }
 
 template< typename Key, typename Value >
-void sobolevsky::MyMultiMap< Key, Value >::insert(const std::pair< Key, Value > &pair)
+typename sobolevsky::List< Value >::Iterator sobolevsky::MyMultiMap< Key, Value >::insert(const std::pair< Key, Value > &pair)
 {
-  if (find(pair.first) != end())
+  Iterator iter(find(pair.first));
+  if (iter != end())
   {
-    find(pair.first)->pushBack(pair.second);
-    size_++;
+    iter->pushBack(pair.second);
   }
   else
   {
     root = push(pair.first, pair.second, root);
-    size_++;
+    root->parent = nullptr;
+    iter = find(pair.first);
   }
+  size_++;
+  return iter->rbegin();
 }
 
 template< typename Key, typename Value >
@@ -160,41 +223,40 @@ typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key
 {
   if (node_ == nullptr)
   {
-    node_ = new Node(key, value);
+    return new Node(key, value);
   }
   else if (key < node_->key_)
   {
     node_->left = push(key, value, node_->left);
     node_->left->parent = node_;
-    node_->height++;
-    if (height(node_->left) - height(node_->right) > 1)
-    {
-      if (node_->right == nullptr || key < node_->left->key_)
-      {
-        node_ = RightRotate(node_);
-      }
-      else
-      {
-        node_ = LeftRightRotate(node_);
-      }
-    }
   }
-  else if (key > node_->key_)
+  else
   {
     node_->right = push(key, value, node_->right);
     node_->right->parent = node_;
-    node_->height++;
-    if ((height(node_->right) - height(node_->left)) > 1)
+  }
+  return balance(node_);
+}
+
+template< typename Key, typename Value >
+typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key, Value >::balance(Node *node_)
+{
+  node_->height = std::max(height(node_->left), height(node_->right)) + 1;
+  if (height(node_->left) > height(node_->right) + 1)
+  {
+    if (height(node_->left->left) >= height(node_->left->right))
+    {
+      return RightRotate(node_);
+    }
+    return LeftRightRotate(node_);
+  }
+  if (height(node_->right) > height(node_->left) + 1)
+  {
+    if (height(node_->right->right) >= height(node_->right->left))
     {
-      if (node_->left == nullptr || key > node_->right->key_)
-      {
-        node_ = LeftRotate(node_);
-      }
-      else
-      {
-        node_ = RightLeftRotate(node_);
-      }
+      return LeftRotate(node_);
     }
+    return RightLeftRotate(node_);
   }
   return node_;
 }
@@ -251,15 +313,43 @@ typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key
 template< typename Key, typename Value >
 void sobolevsky::MyMultiMap< Key, Value >::erase(const Key &key)
 {
+  Iterator iter(find(key));
+  if (iter == end())
+  {
+    return;
+  }
+  size_ -= iter->size();
   root = delet(key, root);
+  if (root != nullptr)
+  {
+    root->parent = nullptr;
+  }
+}
+
+template< typename Key, typename Value >
+void sobolevsky::MyMultiMap< Key, Value >::erase(const Key &key, typename List< Value >::Iterator position)
+{
+  Iterator iter(find(key));
+  if (iter == end())
+  {
+    return;
+  }
+  iter->erase(position);
   size_--;
+  if (iter->empty())
+  {
+    root = delet(key, root);
+    if (root != nullptr)
+    {
+      root->parent = nullptr;
+    }
+  }
 }
 
 template< typename Key, typename Value >
 void sobolevsky::MyMultiMap< Key, Value >::erase(ConstIterator position)
 {
-  root = delet(position->key_, root);
-  size_--;
+  erase(position.node_->key_);
 }
 
 template< typename Key, typename Value >
@@ -272,10 +362,18 @@ typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key
   else if (key < node_->key_)
   {
     node_->left = delet(key, node_->left);
+    if (node_->left != nullptr)
+    {
+      node_->left->parent = node_;
+    }
   }
   else if (key > node_->key_)
   {
     node_->right = delet(key, node_->right);
+    if (node_->right != nullptr)
+    {
+      node_->right->parent = node_;
+    }
   }
   else if (node_->left && node_->right)
   {
@@ -284,52 +382,25 @@ typename sobolevsky::MyMultiMap< Key, Value >::Node *sobolevsky::MyMultiMap< Key
     {
       temp = temp->left;
     }
-    node_->data = temp->data;
-    node_->right = delet(node_->key_, node_->right);
-  }
-  else
-  {
-    Node *temp = node_;
-    if (node_->left == nullptr)
-    {
-      node_ = node_->right;
-    }
-    else if (node_->right== nullptr)
-    {
-      node_ = node_->left;
-    }
-  }
-
-  if (node_ == nullptr)
-  {
-    return nullptr;
-  }
-
-  node_->height = std::max(height(node_->left), height(node_->right)) + 1;
-
-  if (height(node_->left) - height(node_->right) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
-  {
-    if (height(node_->left->left) - height(node_->left->right) > 0)
-    {
-      return LeftRotate(node_);
-    }
-    else if (node_->right != nullptr)
+    std::swap(node_->key_, temp->key_);
+    node_->data.swap(temp->data);
+    node_->right = delet(key, node_->right);
+    if (node_->right != nullptr)
     {
-      return RightLeftRotate(node_);
+      node_->right->parent = node_;
     }
   }
-  else if (height(node_->right) - height(node_->left) > 1 && (node_->right != nullptr) && (node_->left != nullptr))
+  else
   {
-    if (height(node_->right->right) - height(node_->right->left) > 0)
-    {
-      return RightRotate(node_);
-    }
-    else if (node_->left != nullptr)
+    Node *temp = (node_->left == nullptr) ? node_->right : node_->left;
+    if (temp != nullptr)
     {
-      return LeftRightRotate(node_);
+      temp->parent = node_->parent;
     }
+    delete node_;
+    return temp;
   }
-  return node_;
+  return balance(node_);
 }
 
 template< typename Key, typename Value >
@@ -368,11 +439,12 @@ void sobolevsky::MyMultiMap< Key, Value >::swap(MyMultiMap &x)
 template< typename Key, typename Value >
 size_t sobolevsky::MyMultiMap< Key, Value >::count(const Key &key)
 {
-  if (find(key) == end())
+  Iterator iter(find(key));
+  if (iter == end())
   {
     return 0;
   }
-  return find(key)->data.size();
+  return iter->size();
 }
 
 template< typename Key, typename Value >
@@ -544,7 +616,7 @@ template< typename Key, typename Value >
 typename sobolevsky::MyMultiMap< Key, Value >::Iterator sobolevsky::MyMultiMap< Key, Value >::begin() noexcept
 {
   Node *temp = root;
-  while (temp->left != nullptr)
+  while (temp != nullptr && temp->left != nullptr)
   {
     temp = temp->left;
   }
@@ -561,7 +633,7 @@ template< typename Key, typename Value >
 typename sobolevsky::MyMultiMap< Key, Value >::Iterator sobolevsky::MyMultiMap< Key, Value >::rbegin() noexcept
 {
   Node *temp = root;
-  while (temp->right != nullptr)
+  while (temp != nullptr && temp->right != nullptr)
   {
     temp = temp->right;
   }
@@ -572,7 +644,7 @@ template< typename Key, typename Value >
 typename sobolevsky::MyMultiMap< Key, Value >::ConstIterator sobolevsky::MyMultiMap< Key, Value >::cbegin() const noexcept
 {
   Node *temp = root;
-  while (temp->left != nullptr)
+  while (temp != nullptr && temp->left != nullptr)
   {
     temp = temp->left;
   }
@@ -10,46 +10,21 @@ void sobolevsky::errorInpName(std::ostream & out)
   out << "ERROR: SOMETHING WITH FILE NAME/SOMETHING WITH DICT NAME\n";
 }
 
-bool sobolevsky::isNameHere(mypair &pair, const std::string &name)
-{
-  return pair.first == name;
-}
-
 void sobolevsky::dictOutput(mypair &myPair, std::ostream & out, size_t n, bool mode)
 {
   size_t i = 0;
-  for (MyMultiMap< size_t, std::string >::Iterator iter = myPair.second.rbegin(); iter != myPair.second.end(); iter--)
+  FreqDict::freqs_t &freqs = myPair.second.getFreqs();
+  for (FreqDict::freqs_t::Iterator iter = freqs.rbegin(); iter != freqs.end() && i < n; iter--)
   {
-    if (iter->size() == 1)
+    for (List< std::string >::Iterator word = iter->begin(); word != iter->end() && i < n; word++)
     {
       i++;
-      out << (*iter)[0];
+      out << *word;
       if (mode)
       {
         out << " " << iter.getKey();
       }
       out << "\n";
-      if (i == n)
-      {
-        break;
-      }
-    }
-    else
-    {
-      for (size_t j = 0; j < iter->size(); j++)
-      {
-        i++;
-        out << (*iter)[j];
-        if (mode)
-        {
-          out << " " << iter.getKey();
-        }
-        out << "\n";
-        if (i == n)
-        {
-          break;
-        }
-      }
     }
   }
 }
@@ -69,19 +44,3 @@ char sobolevsky::charCheck(char in)
     return 0;
   }
 }
-
-typename sobolevsky::List< mypair >::Iterator sobolevsky::findIf(typename sobolevsky::List< mypair >::Iterator &&first,
-typename sobolevsky::List< mypair >::Iterator &&last, std::string &name)
-{
-  List< mypair >::Iterator iterFirst(first);
-  List< mypair >::Iterator iterLast(last);
-  while (iterFirst != iterLast)
-  {
-    if (isNameHere(*iterFirst, name))
-    {
-      return iterFirst;
-    }
-    iterFirst++;
-  }
-  return iterFirst;
-}
@@ -3,6 +3,7 @@
 #include <iterator>
 #include <fstream>
 #include <limits>
+#include <sstream>
 
 std::string zheleznyakov::statusString(std::string msg, std::string status)
 {
@@ -25,15 +26,18 @@ std::ostream & zheleznyakov::commands::help(std::istream & in, std::ostream & ou
   << "  list                        List saved strings\n"
   << "  create < title >            Create an empty string\n"
   << "  rm < title >                Remove the string\n"
-  << "  cmp < title1 > < title2 >   Compare two strings, and list simular words\n"
-  << "  diff < title1 > < title2 >  Compare two strings, and list different words\n"
+  << "  cmp < title1 > < title2 >   Compare two strings, and list simular words with their counts\n"
+  << "  diff < title1 > < title2 >  Compare two strings, and list different words and changed counts\n"
+  << "  diff < t1 > < t2 > -l       Compare two strings line by line\n"
   << "  enter < title >             Switch to the 'string' mode\n"
   << "\n"
   << "Available string commands:\n"
   << "  read (-f < filename >)      Reads string from stdin or a file\n"
+  << "  append (-f < filename >)    Appends text from stdin or a file to the string\n"
   << "  table (-f < filename >)     Writes a word table to an stdout or a file\n"
   << "  info < word >               Prints an info for a word: count in the present string and its coordinates\n"
   << "  stats                       Print an overall string stats: total words count and an unique words count\n"
+  << "  phrase < word1 > ...        Prints the coordinates where the words follow each other in one line\n"
   << "  quit                        Quit from a 'string' mode\n";
 }
 
@@ -104,19 +108,12 @@ std::ostream & zheleznyakov::commands::cmp(strings_t & strings, std::istream & i
     out << statusString("Key 2 is not found\n", "error");
     throw std::logic_error("");
   }
-  wordpairs_t s1 = strings.at(l1).second;
-  wordpairs_t s2 = strings.at(l2).second;
-  for (auto it = s2.begin(); it != s2.end(); ++it)
+  auto skip = [](const std::pair< std::string, wordpair_t > &) {};
+  auto printCommon = [&out](const std::pair< std::string, wordpair_t > & lhs, const std::pair< std::string, wordpair_t > & rhs)
   {
-    for (auto subit = s1.begin(); subit != s1.end(); ++subit)
-    {
-      if (it->first == subit->first)
-      {
-        out << it->first << '\n';
-        break;
-      }
-    }
-  }
+    out << countsToString(lhs.first, lhs.second.getSize(), rhs.second.getSize()) << '\n';
+  };
+  compareDicts(strings[l1].dict, strings[l2].dict, skip, printCommon, skip);
   return out;
 }
 
@@ -144,50 +141,51 @@ std::ostream & zheleznyakov::commands::diff(strings_t & strings, std::istream &
     out << statusString("Key 2 is not found\n", "error");
     throw std::logic_error("");
   }
-  wordpairs_t s1 = strings.at(l1).second;
-  wordpairs_t s2 = strings.at(l2).second;
-  out << "Only in '" << l1 << "':\n";
-  for (auto it = s1.begin(); it != s1.end(); ++it)
+  std::string flag;
+  std::getline(in, flag);
+  flag.erase(0, flag.find_first_not_of(' '));
+  flag.erase(flag.find_last_not_of(' ') + 1);
+  if (flag == "-l")
   {
-    bool flag = true;
-    for (auto subit = s2.begin(); subit != s2.end(); ++subit)
+    std::vector< std::string > lines1 = splitLines(strings[l1].text);
+    std::vector< std::string > lines2 = splitLines(strings[l2].text);
+    std::vector< lineedit_t > edits = diffLines(lines1, lines2);
+    for (const lineedit_t & edit : edits)
     {
-      if (it->first == subit->first)
-      {
-        flag = false;
-        break;
-      }
-    }
-    if (flag)
-    {
-      out << it->first << '\n';
+      out << edit.first << ' ' << (edit.first == '+' ? lines2[edit.second] : lines1[edit.second]) << '\n';
     }
+    return out;
   }
-  out << "\nOnly in '" << l2 << "':\n";
-  for (auto it = s2.begin(); it != s2.end(); ++it)
+  if (!flag.empty())
   {
-    bool flag = true;
-    for (auto subit = s1.begin(); subit != s1.end(); ++subit)
-    {
-      if (it->first == subit->first)
-      {
-        flag = false;
-        break;
-      }
-    }
-    if (flag)
+    out << statusString("No known flag is passed\n", "error");
+    throw std::logic_error("");
+  }
+
+  std::ostringstream onlySecond;
+  std::ostringstream changed;
+  out << "Only in '" << l1 << "':\n";
+  auto printFirst = [&out](const std::pair< std::string, wordpair_t > & pair)
+  {
+    out << wordEntryToString(pair) << '\n';
+  };
+  auto printSecond = [&onlySecond](const std::pair< std::string, wordpair_t > & pair)
+  {
+    onlySecond << wordEntryToString(pair) << '\n';
+  };
+  auto printChanged = [&changed](const std::pair< std::string, wordpair_t > & lhs, const std::pair< std::string, wordpair_t > & rhs)
+  {
+    if (lhs.second.getSize() != rhs.second.getSize())
     {
-      out << it->first << '\n';
+      changed << "* " << countsToString(lhs.first, lhs.second.getSize(), rhs.second.getSize()) << '\n';
     }
-  }
+  };
+  compareDicts(strings[l1].dict, strings[l2].dict, printFirst, printChanged, printSecond);
+  out << "\nOnly in '" << l2 << "':\n" << onlySecond.str();
+  out << "\nChanged:\n" << changed.str();
   return out;
 }
 
-bool zheleznyakov::hasNoWord(const wordpairs_t & ref, const std::string word)
-{
-  return ref.find(word) == ref.cend();
-}
-
 std::ostream & zheleznyakov::commands::enter(strings_t & strings, std::string & active, std::istream & in, std::ostream & out)
 {
   if (active != "")
@@ -214,6 +212,32 @@ std::ostream & zheleznyakov::commands::read(strings_t & strings, std::string & a
     throw std::logic_error("");
   }
 
+  std::string contents = readContents(in, out);
+  string_t & current = strings[active];
+  current.text = contents;
+  current.dict.clear();
+  current.state = DictState();
+  appendDict(current.dict, current.state, current.text);
+  return out;
+}
+
+std::ostream & zheleznyakov::commands::append(strings_t & strings, std::string & active, std::istream & in, std::ostream & out)
+{
+  if (active == "")
+  {
+    out << statusString("Not in string mode\n", "error");
+    throw std::logic_error("");
+  }
+
+  std::string contents = readContents(in, out);
+  string_t & current = strings[active];
+  current.text += contents;
+  appendDict(current.dict, current.state, contents);
+  return out;
+}
+
+std::string zheleznyakov::readContents(std::istream & in, std::ostream & out)
+{
   std::string line;
   std::getline(in, line);
 
@@ -234,26 +258,17 @@ std::ostream & zheleznyakov::commands::read(strings_t & strings, std::string & a
       out << statusString("Unable to read the file\n", "error");
       throw std::logic_error("");
     }
-    std::string contents((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
-    wordpairs_t pairs = getDict(contents);
-    string_t currentStruct{ contents, pairs };
-    strings[active] = currentStruct;
+    return std::string((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
   }
-  else
-  {
-    std::string contents = line + '\n';
-    while (std::getline(in, line)) {
-      if (line == "[fin.]")
-      {
-        break;
-      }
-      contents += line + '\n';
+  std::string contents = line + '\n';
+  while (std::getline(in, line)) {
+    if (line == "[fin.]")
+    {
+      break;
     }
-    wordpairs_t pairs = getDict(contents);
-    string_t currentStruct{ contents, pairs };
-    strings[active] = currentStruct;
+    contents += line + '\n';
   }
-  return out;
+  return contents;
 }
 
 std::ostream & zheleznyakov::commands::table(strings_t & strings, std::string & active, std::istream & in, std::ostream & out)
@@ -275,7 +290,7 @@ std::ostream & zheleznyakov::commands::table(strings_t & strings, std::string &
     std::string filename;
     in >> filename;
     std::ofstream fout(filename);
-    const wordpairs_t pairs = strings.at(active).second;
+    const wordpairs_t & pairs = strings[active].dict;
     for (auto it = pairs.cbegin(); it != pairs.cend(); ++it)
     {
       fout << it->first << ':' << std::to_string(it->second.getSize()) << '\n';
@@ -283,7 +298,7 @@ std::ostream & zheleznyakov::commands::table(strings_t & strings, std::string &
   }
   else
   {
-    const wordpairs_t pairs = strings.at(active).second;
+    const wordpairs_t & pairs = strings[active].dict;
     for (auto it = pairs.cbegin(); it != pairs.cend(); ++it)
     {
       out << it->first << ':' << std::to_string(it->second.getSize()) << '\n';
@@ -296,13 +311,13 @@ std::ostream & zheleznyakov::commands::info(strings_t & strings, std::string & a
 {
   std::string word;
   in >> word;
-  string_t currentString = strings.at(active);
-  if (currentString.second.find(word) == currentString.second.end())
+  string_t & currentString = strings[active];
+  if (currentString.dict.find(word) == currentString.dict.end())
   {
     out << statusString("Word is not found\n", "error");
     throw std::logic_error("");
   }
-  wordpair_t currentWord = currentString.second[word];
+  const wordpair_t & currentWord = currentString.dict[word];
   out << word << '\n'
   << "Repeats: " << currentWord.getSize() << '\n'
   << "Coords:\n";
@@ -320,9 +335,37 @@ std::ostream & zheleznyakov::commands::stats(strings_t & strings, std::string &
     out << statusString("No additional args allowed\n", "warn");
     throw std::logic_error("");
   }
-  string_t currentString = strings.at(active);
-  out << "Total words in dict: " << currentString.second.getSize() << '\n'
-  << "Total chars: " << currentString.first.size() << "\n";
+  const string_t & currentString = strings[active];
+  out << "Total words in dict: " << currentString.dict.getSize() << '\n'
+  << "Total chars: " << currentString.text.size() << "\n"
+  << "Text memory: " << currentString.text.capacity() << " bytes\n"
+  << "Index memory: " << getDictMemory(currentString.dict) << " bytes\n";
+  return out;
+}
+
+std::ostream & zheleznyakov::commands::phrase(strings_t & strings, std::string & active, std::istream & in, std::ostream & out)
+{
+  if (active == "")
+  {
+    out << statusString("Not in string mode\n", "error");
+    throw std::logic_error("");
+  }
+  std::string line;
+  std::getline(in, line);
+  std::istringstream words(line);
+  std::vector< std::string > phraseWords{ std::istream_iterator< std::string >(words), std::istream_iterator< std::string >() };
+  if (phraseWords.empty())
+  {
+    out << statusString("No words are passed\n", "error");
+    throw std::logic_error("");
+  }
+  std::vector< wordcoord_t > matches = findPhrase(strings[active].dict, phraseWords);
+  out << "Matches: " << matches.size() << '\n'
+  << "Coords:\n";
+  for (const wordcoord_t & coord : matches)
+  {
+    out << coordsToPairs(coord) << '\n';
+  }
   return out;
 }
 
@@ -361,3 +404,9 @@ std::string zheleznyakov::wordEntryToString(const std::pair< std::string, wordpa
 {
   return pair.first + ':' + std::to_string(pair.second.getSize());
 }
+
+std::string zheleznyakov::countsToString(const std::string & word, size_t count1, size_t count2)
+{
+  std::string delta = count2 >= count1 ? '+' + std::to_string(count2 - count1) : '-' + std::to_string(count1 - count2);
+  return word + ':' + std::to_string(count1) + ':' + std::to_string(count2) + " (" + delta + ')';
+}
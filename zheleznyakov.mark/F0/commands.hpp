@@ -6,10 +6,16 @@
 #include <tree.hpp>
 #include <list.hpp>
 #include "dict.hpp"
+#include "lineDiff.hpp"
 
 namespace zheleznyakov
 {
-  using string_t = std::pair< std::string, wordpairs_t >;
+  struct string_t
+  {
+    std::string text;
+    wordpairs_t dict;
+    DictState state;
+  };
   using strings_t = Tree< std::string, string_t >;
 
   namespace commands
@@ -23,20 +29,22 @@ namespace zheleznyakov
     std::ostream & enter(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
 
     std::ostream & read(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
+    std::ostream & append(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
     std::ostream & table(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
     std::ostream & info(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
     std::ostream & stats(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
+    std::ostream & phrase(strings_t & strings, std::string & active, std::istream & in, std::ostream & out);
     std::ostream & quit(std::string &, std::istream & in, std::ostream & out);
   }
 
   std::string statusString(std::string, std::string);
   std::string prompt(std::string);
+  std::string readContents(std::istream & in, std::ostream & out);
 
   std::string extractKeyFromStringsPair(const std::pair< std::string, string_t > & pair);
   std::string extractKeyFromWordpair(const std::pair< std::string, wordpair_t > & pair);
   std::string coordsToPairs(const wordcoord_t & wordCoord);
   std::string wordEntryToString(const std::pair< std::string, wordpair_t >& pair);
-  bool hasWord(const wordpairs_t & ref, const std::string word);
-  bool hasNoWord(const wordpairs_t & ref, const std::string word);
+  std::string countsToString(const std::string & word, size_t count1, size_t count2);
 }
 #endif
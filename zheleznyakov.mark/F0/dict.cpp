@@ -25,45 +25,127 @@ size_t zheleznyakov::getWordsCount(std::string s)
 zheleznyakov::wordpairs_t zheleznyakov::getDict(const std::string & str)
 {
   wordpairs_t wordMap;
-  std::string word = "";
-  size_t line = 1;
-  size_t position = 1;
+  DictState state;
+  appendDict(wordMap, state, str);
+  return wordMap;
+}
 
-  for (char c : str)
+void zheleznyakov::appendDict(wordpairs_t & wordMap, DictState & state, const std::string & str)
+{
+  if (str.empty())
+  {
+    return;
+  }
+  if (state.pending)
   {
-    if (c == '\n')
+    wordpair_t & coords = wordMap[state.word];
+    coords.popBack();
+    if (coords.getSize() == 0)
     {
-      line++;
-      position = 1;
+      wordMap.erase(state.word);
     }
+    state.pending = false;
+  }
 
+  for (char c : str)
+  {
     if (c == ' ' || c == '\n')
     {
-      if (!word.empty())
+      if (!state.word.empty())
+      {
+        wordMap[state.word].pushBack(std::make_pair(state.line, state.position));
+        state.word.clear();
+      }
+      if (c == '\n')
       {
-        wordMap[word].pushBack(std::make_pair(line, position));
-        word.clear();
+        state.line++;
+        state.position = 1;
+      }
+      else
+      {
+        state.position++;
       }
-      position++;
     }
     else
     {
       if (!zheleznyakov::isPunctuationMark(c))
       {
-        word += c;
+        state.word += c;
       }
     }
   }
 
-  if (!word.empty())
+  if (!state.word.empty())
   {
-    wordMap[word].pushBack(std::make_pair(line, position));
+    wordMap[state.word].pushBack(std::make_pair(state.line, state.position));
+    state.pending = true;
   }
-
-  return wordMap;
 }
 
 bool zheleznyakov::isPunctuationMark(const char c)
 {
   return c == '.' || c == ',' || c == ';' || c == '!' || c == '?' || c == ':' || c == ';';
 }
+
+std::vector< zheleznyakov::wordcoord_t > zheleznyakov::findPhrase(const wordpairs_t & dict, const std::vector< std::string > & words)
+{
+  std::vector< wordcoord_t > result;
+  std::vector< wordpair_t::ConstIterator > cursors;
+  std::vector< wordpair_t::ConstIterator > ends;
+  for (const std::string & word : words)
+  {
+    auto it = dict.find(word);
+    if (it == dict.cend())
+    {
+      return result;
+    }
+    cursors.push_back(it->second.begin());
+    ends.push_back(it->second.end());
+  }
+  if (cursors.empty())
+  {
+    return result;
+  }
+
+  while (cursors[0] != ends[0])
+  {
+    wordcoord_t start = *cursors[0];
+    bool matched = true;
+    for (size_t i = 1; i < cursors.size(); ++i)
+    {
+      wordcoord_t target(start.first, start.second + i);
+      if (cursors[i].seek(target) == ends[i])
+      {
+        return result;
+      }
+      if (*cursors[i] != target)
+      {
+        const wordcoord_t & found = *cursors[i];
+        start = wordcoord_t(found.first, found.second > i ? found.second - i : 1);
+        matched = false;
+        break;
+      }
+    }
+    if (matched)
+    {
+      result.push_back(start);
+      ++cursors[0];
+    }
+    else
+    {
+      cursors[0].seek(start);
+    }
+  }
+  return result;
+}
+
+size_t zheleznyakov::getDictMemory(const wordpairs_t & dict)
+{
+  const size_t nodeOverhead = 3 * sizeof(void *) + sizeof(size_t);
+  size_t memory = 0;
+  for (auto it = dict.cbegin(); it != dict.cend(); ++it)
+  {
+    memory += sizeof(*it) + nodeOverhead + it->first.capacity() + it->second.getMemoryUsage() - sizeof(wordpair_t);
+  }
+  return memory;
+}
@@ -3,18 +3,58 @@
 #include <string>
 #include <vector>
 #include <tree.hpp>
-#include <list.hpp>
+#include "postings.hpp"
 
 namespace zheleznyakov
 {
-  using wordcoord_t = std::pair< size_t, size_t >;
-  using wordpair_t = List< wordcoord_t >;
+  using wordpair_t = PostingList;
   using wordpairs_t = Tree< std::string, wordpair_t >;
 
+  struct DictState
+  {
+    size_t line = 1;
+    size_t position = 1;
+    std::string word;
+    bool pending = false;
+  };
+
   size_t getWordsCount(std::string);
   size_t getLinesCount(std::string);
 
   wordpairs_t getDict(const std::string &);
+  void appendDict(wordpairs_t &, DictState &, const std::string &);
   bool isPunctuationMark(const char c);
+  std::vector< wordcoord_t > findPhrase(const wordpairs_t &, const std::vector< std::string > &);
+  size_t getDictMemory(const wordpairs_t &);
+
+  template< typename OnlyFirst, typename Common, typename OnlySecond >
+  void compareDicts(const wordpairs_t &, const wordpairs_t &, OnlyFirst, Common, OnlySecond);
+}
+
+template< typename OnlyFirst, typename Common, typename OnlySecond >
+void zheleznyakov::compareDicts(const wordpairs_t & lhs, const wordpairs_t & rhs,
+  OnlyFirst onlyFirst, Common common, OnlySecond onlySecond)
+{
+  auto lhsIt = lhs.cbegin();
+  auto rhsIt = rhs.cbegin();
+  while (lhsIt != lhs.cend() || rhsIt != rhs.cend())
+  {
+    if (rhsIt == rhs.cend() || (lhsIt != lhs.cend() && lhsIt->first < rhsIt->first))
+    {
+      onlyFirst(*lhsIt);
+      ++lhsIt;
+    }
+    else if (lhsIt == lhs.cend() || rhsIt->first < lhsIt->first)
+    {
+      onlySecond(*rhsIt);
+      ++rhsIt;
+    }
+    else
+    {
+      common(*lhsIt, *rhsIt);
+      ++lhsIt;
+      ++rhsIt;
+    }
+  }
 }
 #endif
@@ -0,0 +1,194 @@
+#include "lineDiff.hpp"
+#include <unordered_map>
+
+namespace zheleznyakov
+{
+  using lineids_t = std::vector< size_t >;
+
+  void diffRange(const lineids_t &, size_t, size_t, const lineids_t &, size_t, size_t, std::vector< lineedit_t > &);
+  bool findSplit(const lineids_t &, size_t, size_t, const lineids_t &, size_t, size_t, size_t &, size_t &);
+}
+
+std::vector< std::string > zheleznyakov::splitLines(const std::string & text)
+{
+  std::vector< std::string > lines;
+  size_t start = 0;
+  while (start < text.size())
+  {
+    size_t end = text.find('\n', start);
+    if (end == std::string::npos)
+    {
+      end = text.size();
+    }
+    lines.push_back(text.substr(start, end - start));
+    start = end + 1;
+  }
+  return lines;
+}
+
+std::vector< zheleznyakov::lineedit_t > zheleznyakov::diffLines(const std::vector< std::string > & lhs,
+  const std::vector< std::string > & rhs)
+{
+  std::unordered_map< std::string, size_t > ids;
+  lineids_t a;
+  lineids_t b;
+  a.reserve(lhs.size());
+  b.reserve(rhs.size());
+  for (const std::string & line : lhs)
+  {
+    a.push_back(ids.emplace(line, ids.size()).first->second);
+  }
+  for (const std::string & line : rhs)
+  {
+    b.push_back(ids.emplace(line, ids.size()).first->second);
+  }
+  std::vector< lineedit_t > edits;
+  edits.reserve(a.size() + b.size());
+  diffRange(a, 0, a.size(), b, 0, b.size(), edits);
+  return edits;
+}
+
+void zheleznyakov::diffRange(const lineids_t & a, size_t aFirst, size_t aLast,
+  const lineids_t & b, size_t bFirst, size_t bLast, std::vector< lineedit_t > & edits)
+{
+  size_t suffix = 0;
+  while (aFirst < aLast && bFirst < bLast && a[aFirst] == b[bFirst])
+  {
+    edits.emplace_back(' ', aFirst++);
+    bFirst++;
+  }
+  while (aFirst < aLast && bFirst < bLast && a[aLast - 1] == b[bLast - 1])
+  {
+    aLast--;
+    bLast--;
+    suffix++;
+  }
+  if (aFirst == aLast)
+  {
+    for (size_t i = bFirst; i < bLast; ++i)
+    {
+      edits.emplace_back('+', i);
+    }
+  }
+  else if (bFirst == bLast)
+  {
+    for (size_t i = aFirst; i < aLast; ++i)
+    {
+      edits.emplace_back('-', i);
+    }
+  }
+  else
+  {
+    size_t aSplit = 0;
+    size_t bSplit = 0;
+    if (findSplit(a, aFirst, aLast, b, bFirst, bLast, aSplit, bSplit))
+    {
+      diffRange(a, aFirst, aSplit, b, bFirst, bSplit, edits);
+      diffRange(a, aSplit, aLast, b, bSplit, bLast, edits);
+    }
+    else
+    {
+      for (size_t i = aFirst; i < aLast; ++i)
+      {
+        edits.emplace_back('-', i);
+      }
+      for (size_t i = bFirst; i < bLast; ++i)
+      {
+        edits.emplace_back('+', i);
+      }
+    }
+  }
+  for (size_t i = 0; i < suffix; ++i)
+  {
+    edits.emplace_back(' ', aLast + i);
+  }
+}
+
+bool zheleznyakov::findSplit(const lineids_t & a, size_t aFirst, size_t aLast,
+  const lineids_t & b, size_t bFirst, size_t bLast, size_t & aSplit, size_t & bSplit)
+{
+  const long n = aLast - aFirst;
+  const long m = bLast - bFirst;
+  const long maxD = (n + m + 1) / 2;
+  const long offset = maxD;
+  const long length = 2 * maxD + 2;
+  std::vector< long > forward(length, -1);
+  std::vector< long > backward(length, -1);
+  forward[offset + 1] = 0;
+  backward[offset + 1] = 0;
+  const long delta = n - m;
+  const bool front = delta % 2 != 0;
+  long kForwardStart = 0;
+  long kForwardEnd = 0;
+  long kBackwardStart = 0;
+  long kBackwardEnd = 0;
+  for (long d = 0; d < maxD; ++d)
+  {
+    for (long k = -d + kForwardStart; k <= d - kForwardEnd; k += 2)
+    {
+      long index = offset + k;
+      long x = (k == -d || (k != d && forward[index - 1] < forward[index + 1])) ? forward[index + 1] : forward[index - 1] + 1;
+      long y = x - k;
+      while (x < n && y < m && a[aFirst + x] == b[bFirst + y])
+      {
+        ++x;
+        ++y;
+      }
+      forward[index] = x;
+      if (x > n)
+      {
+        kForwardEnd += 2;
+      }
+      else if (y > m)
+      {
+        kForwardStart += 2;
+      }
+      else if (front)
+      {
+        long other = offset + delta - k;
+        if (other >= 0 && other < length && backward[other] != -1 && x >= n - backward[other])
+        {
+          aSplit = aFirst + x;
+          bSplit = bFirst + y;
+          return true;
+        }
+      }
+    }
+    for (long k = -d + kBackwardStart; k <= d - kBackwardEnd; k += 2)
+    {
+      long index = offset + k;
+      long x = (k == -d || (k != d && backward[index - 1] < backward[index + 1])) ? backward[index + 1] : backward[index - 1] + 1;
+      long y = x - k;
+      while (x < n && y < m && a[aLast - x - 1] == b[bLast - y - 1])
+      {
+        ++x;
+        ++y;
+      }
+      backward[index] = x;
+      if (x > n)
+      {
+        kBackwardEnd += 2;
+      }
+      else if (y > m)
+      {
+        kBackwardStart += 2;
+      }
+      else if (!front)
+      {
+        long other = offset + delta - k;
+        if (other >= 0 && other < length && forward[other] != -1)
+        {
+          long xForward = forward[other];
+          long yForward = offset + xForward - other;
+          if (xForward >= n - x)
+          {
+            aSplit = aFirst + xForward;
+            bSplit = bFirst + yForward;
+            return true;
+          }
+        }
+      }
+    }
+  }
+  return false;
+}
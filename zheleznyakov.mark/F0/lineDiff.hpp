@@ -0,0 +1,14 @@
+#ifndef LINE_DIFF_HPP
+#define LINE_DIFF_HPP
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace zheleznyakov
+{
+  using lineedit_t = std::pair< char, size_t >;
+
+  std::vector< std::string > splitLines(const std::string &);
+  std::vector< lineedit_t > diffLines(const std::vector< std::string > &, const std::vector< std::string > &);
+}
+#endif
@@ -24,9 +24,11 @@ int main()
     cmds["enter"] = std::bind(commands::enter, _1, _2, _3, _4);
 
     cmds["read"] = std::bind(commands::read, _1, _2, _3, _4);
+    cmds["append"] = std::bind(commands::append, _1, _2, _3, _4);
     cmds["table"] = std::bind(commands::table, _1, _2, _3, _4);
     cmds["info"] = std::bind(commands::info, _1, _2, _3, _4);
     cmds["stats"] = std::bind(commands::stats, _1, _2, _3, _4);
+    cmds["phrase"] = std::bind(commands::phrase, _1, _2, _3, _4);
     cmds["quit"] = std::bind(commands::quit, _2, _3, _4);
   }
 
@@ -0,0 +1,226 @@
+#include "postings.hpp"
+#include <stdexcept>
+
+namespace zheleznyakov
+{
+  void writeVarint(std::string & out, size_t value)
+  {
+    while (value >= 0x80)
+    {
+      out.push_back(static_cast< char >((value & 0x7F) | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast< char >(value));
+  }
+
+  size_t readVarint(const std::string & in, size_t & offset)
+  {
+    size_t value = 0;
+    for (size_t shift = 0; offset < in.size(); shift += 7)
+    {
+      unsigned char byte = static_cast< unsigned char >(in[offset++]);
+      value |= static_cast< size_t >(byte & 0x7F) << shift;
+      if (!(byte & 0x80))
+      {
+        break;
+      }
+    }
+    return value;
+  }
+}
+
+const size_t zheleznyakov::PostingList::blockSize;
+
+zheleznyakov::PostingList::PostingList():
+  data_(),
+  skips_(),
+  size_(0),
+  last_(0, 0)
+{}
+
+void zheleznyakov::PostingList::pushBack(const wordcoord_t & coord)
+{
+  if (size_ != 0 && coord < last_)
+  {
+    throw std::logic_error("Coordinates must be appended in order");
+  }
+  wordcoord_t previous = last_;
+  if (size_ % blockSize == 0)
+  {
+    skips_.push_back(Skip{ coord, data_.size() });
+    previous = wordcoord_t(0, 0);
+  }
+  size_t lineDelta = coord.first - previous.first;
+  writeVarint(data_, lineDelta);
+  writeVarint(data_, lineDelta == 0 ? coord.second - previous.second : coord.second);
+  last_ = coord;
+  size_++;
+}
+
+void zheleznyakov::PostingList::popBack()
+{
+  if (size_ == 0)
+  {
+    throw std::out_of_range("Posting list is empty");
+  }
+  if ((size_ - 1) % blockSize == 0)
+  {
+    data_.resize(skips_.back().offset);
+    skips_.pop_back();
+  }
+  if (size_ == 1)
+  {
+    last_ = wordcoord_t(0, 0);
+  }
+  else
+  {
+    ConstIterator beforeLast(this, size_ - 2);
+    data_.resize(beforeLast.offset_);
+    last_ = *beforeLast;
+  }
+  size_--;
+}
+
+size_t zheleznyakov::PostingList::getSize() const noexcept
+{
+  return size_;
+}
+
+size_t zheleznyakov::PostingList::getMemoryUsage() const noexcept
+{
+  return sizeof(PostingList) + data_.capacity() + skips_.capacity() * sizeof(Skip);
+}
+
+const zheleznyakov::wordcoord_t & zheleznyakov::PostingList::back() const
+{
+  if (size_ == 0)
+  {
+    throw std::out_of_range("Posting list is empty");
+  }
+  return last_;
+}
+
+zheleznyakov::PostingList::ConstIterator zheleznyakov::PostingList::begin() const
+{
+  return ConstIterator(this, 0);
+}
+
+zheleznyakov::PostingList::ConstIterator zheleznyakov::PostingList::end() const
+{
+  return ConstIterator(this, size_);
+}
+
+zheleznyakov::PostingList::ConstIterator::ConstIterator(const PostingList * list, size_t index):
+  list_(list),
+  index_(index),
+  offset_(0),
+  current_(0, 0)
+{
+  if (index < list_->size_)
+  {
+    jumpToBlock(index / blockSize);
+    while (index_ < index)
+    {
+      ++(*this);
+    }
+  }
+}
+
+zheleznyakov::PostingList::ConstIterator & zheleznyakov::PostingList::ConstIterator::operator++()
+{
+  if (index_ == list_->size_)
+  {
+    return *this;
+  }
+  index_++;
+  if (index_ == list_->size_)
+  {
+    return *this;
+  }
+  if (index_ % blockSize == 0)
+  {
+    jumpToBlock(index_ / blockSize);
+  }
+  else
+  {
+    decode(current_);
+  }
+  return *this;
+}
+
+zheleznyakov::PostingList::ConstIterator & zheleznyakov::PostingList::ConstIterator::seek(const wordcoord_t & target)
+{
+  if (index_ == list_->size_ || !(current_ < target))
+  {
+    return *this;
+  }
+  const std::vector< Skip > & skips = list_->skips_;
+  size_t block = index_ / blockSize;
+  size_t low = block;
+  size_t high = block + 1;
+  for (size_t step = 1; high < skips.size() && !(target < skips[high].first); step *= 2)
+  {
+    low = high;
+    high = block + step * 2;
+  }
+  if (high > skips.size())
+  {
+    high = skips.size();
+  }
+  while (high - low > 1)
+  {
+    size_t middle = low + (high - low) / 2;
+    if (target < skips[middle].first)
+    {
+      high = middle;
+    }
+    else
+    {
+      low = middle;
+    }
+  }
+  if (low != block)
+  {
+    jumpToBlock(low);
+  }
+  while (index_ != list_->size_ && current_ < target)
+  {
+    ++(*this);
+  }
+  return *this;
+}
+
+bool zheleznyakov::PostingList::ConstIterator::operator==(const ConstIterator & other) const
+{
+  return list_ == other.list_ && index_ == other.index_;
+}
+
+bool zheleznyakov::PostingList::ConstIterator::operator!=(const ConstIterator & other) const
+{
+  return !(*this == other);
+}
+
+const zheleznyakov::wordcoord_t & zheleznyakov::PostingList::ConstIterator::operator*() const
+{
+  return current_;
+}
+
+const zheleznyakov::wordcoord_t * zheleznyakov::PostingList::ConstIterator::operator->() const
+{
+  return &current_;
+}
+
+void zheleznyakov::PostingList::ConstIterator::jumpToBlock(size_t block)
+{
+  index_ = block * blockSize;
+  offset_ = list_->skips_[block].offset;
+  decode(wordcoord_t(0, 0));
+}
+
+void zheleznyakov::PostingList::ConstIterator::decode(const wordcoord_t & previous)
+{
+  size_t lineDelta = readVarint(list_->data_, offset_);
+  size_t position = readVarint(list_->data_, offset_);
+  current_.first = previous.first + lineDelta;
+  current_.second = lineDelta == 0 ? previous.second + position : position;
+}
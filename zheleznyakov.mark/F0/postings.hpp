@@ -0,0 +1,66 @@
+#ifndef POSTINGS_HPP
+#define POSTINGS_HPP
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace zheleznyakov
+{
+  using wordcoord_t = std::pair< size_t, size_t >;
+
+  class PostingList
+  {
+  public:
+    class ConstIterator;
+
+    PostingList();
+
+    void pushBack(const wordcoord_t &);
+    void popBack();
+    size_t getSize() const noexcept;
+    size_t getMemoryUsage() const noexcept;
+    const wordcoord_t & back() const;
+
+    ConstIterator begin() const;
+    ConstIterator end() const;
+
+  private:
+    struct Skip
+    {
+      wordcoord_t first;
+      size_t offset;
+    };
+
+    static const size_t blockSize = 64;
+
+    std::string data_;
+    std::vector< Skip > skips_;
+    size_t size_;
+    wordcoord_t last_;
+  };
+
+  class PostingList::ConstIterator
+  {
+    friend class PostingList;
+  public:
+    ConstIterator(const PostingList *, size_t);
+
+    ConstIterator & operator++();
+    ConstIterator & seek(const wordcoord_t &);
+
+    bool operator==(const ConstIterator &) const;
+    bool operator!=(const ConstIterator &) const;
+
+    const wordcoord_t & operator*() const;
+    const wordcoord_t * operator->() const;
+  private:
+    const PostingList * list_;
+    size_t index_;
+    size_t offset_;
+    wordcoord_t current_;
+
+    void jumpToBlock(size_t);
+    void decode(const wordcoord_t &);
+  };
+}
+#endif